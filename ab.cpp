@@ -0,0 +1,292 @@
+//==============================================================================
+//
+// ab.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Sequential A/B strategy comparator
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "engine.hpp"
+#include "strategy.hpp"
+#include "thread_pool.hpp"
+
+// comparator constants
+//******************************************************************************
+const int max_shots = FIELD_ROWS * FIELD_COLS; // every cell fired once at most
+const int min_pairs = 16;                      // pairs before the first test
+
+// sequential test outcomes
+//------------------------------------------------------------------------------
+enum sprt_outcome { sprt_running = 0, sprt_candidate = 1, sprt_baseline = 2, sprt_equivalent = 3, sprt_limit = 4 };
+
+const std::vector<std::string> sprt_verdict =
+{
+    "running", "candidate better", "baseline better", "no difference above the margin", "undecided at the game limit"
+};
+
+// sequential test class
+//------------------------------------------------------------------------------
+//
+// Paired differences d = baseline shots - candidate shots (positive when the
+// candidate wins faster), two Wald SPRTs on the normal mean with the sample
+// variance:
+//
+//   candidate test : H0 mean = 0 against H1 mean = +delta
+//   baseline test  : H0 mean = 0 against H1 mean = -delta
+//
+// The candidate (baseline) is better when its test accepts H1, the strategies
+// are equivalent within delta when both tests accept H0.
+//
+class sprt
+{
+    public:
+        // initialization
+        sprt(double delta, double alpha, double beta) noexcept
+        : _delta(delta), _lower(std::log(beta / (1. - alpha))), _upper(std::log((1. - beta) / alpha)),
+          _n(0), _mean(0.), _m2(0.), _sum_a(0.), _sum_b(0.), _h0{ false, false }
+        {}
+
+        // one pair of games, the outcome of the test after it
+        int Add(int candidate_shots, int baseline_shots) noexcept
+        {
+            double d = baseline_shots - candidate_shots;
+            _n++;
+            _sum_a += candidate_shots;
+            _sum_b += baseline_shots;
+            double delta = d - _mean;
+            _mean += delta / _n;
+            _m2   += delta * (d - _mean);
+            if(_n < min_pairs) return sprt_running;
+            for(int t = 0; t < 2; ++t)
+            {
+                double llr = Llr(t);
+                if(llr >= _upper) return (t == 0) ? sprt_candidate : sprt_baseline;
+                if(llr <= _lower) _h0[t] = true;
+            }
+            return (_h0[0] && _h0[1]) ? sprt_equivalent : sprt_running;
+        }
+
+        // log-likelihood ratio of the candidate (0) or baseline (1) test
+        double Llr(int t) const noexcept
+        {
+            double mean = (t == 0) ? _mean : -_mean;
+            return _n * _delta * (mean - 0.5 * _delta) / std::max(Variance(), 1e-6);
+        }
+
+        // get
+        long   inline Pairs()    const noexcept { return _n; }
+        double inline Mean()     const noexcept { return _mean; }
+        double inline Variance() const noexcept { return (_n > 1) ? _m2 / (_n - 1) : 0.; }
+        double inline MeanCandidate() const noexcept { return _sum_a / std::max(_n, 1L); }
+        double inline MeanBaseline()  const noexcept { return _sum_b / std::max(_n, 1L); }
+        double inline Lower()    const noexcept { return _lower; }
+        double inline Upper()    const noexcept { return _upper; }
+
+    private:
+        // instance variables
+        double _delta;
+        double _lower;
+        double _upper;
+        long   _n;
+        double _mean;
+        double _m2;
+        double _sum_a;
+        double _sum_b;
+        bool   _h0[2];
+};
+
+// comparator functions
+//******************************************************************************
+//
+// shots of 's' to sink the fleet of the game seed: both strategies get the
+// same fleet and the same shot seed. The opponent shots do not change the
+// shots to win, so a single side is played; -1 if the game does not end
+//
+template<class S>
+int shots_to_win(S& s, std::uint64_t game_seed)
+{
+    rng             game_rng(game_seed);
+    random_strategy target;
+    target.Seed(game_rng.Next());
+    target.Place();
+    s.Seed(game_rng.Next());
+    s.S::Place();
+    int shots = 0;
+    while(!s.End() && shots < max_shots)
+    {
+        step_result res = play_shot(s, target, first_side, s.S::FireCell());
+        if(res.outcome == shot_invalid) break;
+        shots++;
+    }
+    return s.End() ? shots : -1;
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_ab -a candidate -b baseline [-d shots] [-e alpha] [-f beta] [-n pairs] [-t threads] [-c chunk] [-s seed] [-m us] [-M samples]\n";
+    std::cout << "\n";
+    std::cout << "    -a candidate strategy under test (montecarlo:us for a budget variant)\n";
+    std::cout << "    -b baseline  reference strategy\n";
+    std::cout << "    -d shots     margin on the mean shots to win (default 0.5)\n";
+    std::cout << "    -e alpha     false positive rate of each test (default 0.05)\n";
+    std::cout << "    -f beta      false negative rate of each test (default 0.05)\n";
+    std::cout << "    -n pairs     game pairs limit (default 100000)\n";
+    std::cout << "    -t threads   number of worker threads (default: all cores)\n";
+    std::cout << "    -c chunk     game pairs per scheduled task (default 8)\n";
+    std::cout << "    -s seed      master seed, pair i is played on stream i (default: random)\n";
+    std::cout << "    -m us        montecarlo budget per move in microseconds (default 1000)\n";
+    std::cout << "    -M samples   montecarlo samples cap per move (default: budget only)\n";
+    std::cout << "\n";
+    std::cout << "    strategies   :";
+    for(const std::string& name : strategy_name) std::cout << ' ' << name;
+    std::cout << '\n';
+    std::cout << std::endl;
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::string names[2];
+    double delta   = 0.5;
+    double alpha   = 0.05;
+    double beta    = 0.05;
+    long   limit   = 100000;
+    int    threads = 0;
+    long   chunk   = 8;
+    std::uint64_t seed = thread_rng().Next();
+    montecarlo_config mc;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-a") && i + 1 < argc)      names[0] = argv[++i];
+        else if(!std::strcmp(argv[i], "-b") && i + 1 < argc) names[1] = argv[++i];
+        else if(!std::strcmp(argv[i], "-d") && i + 1 < argc) delta   = std::atof(argv[++i]);
+        else if(!std::strcmp(argv[i], "-e") && i + 1 < argc) alpha   = std::atof(argv[++i]);
+        else if(!std::strcmp(argv[i], "-f") && i + 1 < argc) beta    = std::atof(argv[++i]);
+        else if(!std::strcmp(argv[i], "-n") && i + 1 < argc) limit   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-t") && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-c") && i + 1 < argc) chunk   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-s") && i + 1 < argc) seed    = std::strtoull(argv[++i], nullptr, 10);
+        else if(!std::strcmp(argv[i], "-m") && i + 1 < argc) mc.budget      = std::chrono::microseconds(std::atol(argv[++i]));
+        else if(!std::strcmp(argv[i], "-M") && i + 1 < argc) mc.max_samples = std::atol(argv[++i]);
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    strategy_variant variants[2];
+    if(!parse_strategy_variant(names[0], mc, variants[0]) || !parse_strategy_variant(names[1], mc, variants[1]) ||
+       delta <= 0. || alpha <= 0. || alpha >= 0.5 || beta <= 0. || beta >= 0.5 || limit < min_pairs || chunk <= 0)
+    {
+        usage();
+        return 1;
+    }
+
+    // run the comparison: a batch of pairs on the pool, then the test on the
+    // pairs in order (the outcome does not depend on the number of threads)
+    thread_pool      pool(threads);
+    std::size_t      batch = static_cast<std::size_t>(pool.Size()) * chunk;
+    std::vector<int> shots[2] = { std::vector<int>(batch), std::vector<int>(batch) };
+    sprt test(delta, alpha, beta);
+    int  outcome = sprt_running;
+    long played  = 0;
+    long aborted = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    while(outcome == sprt_running && played < limit)
+    {
+        std::size_t n = std::min<std::size_t>(batch, limit - played);
+        pool.ParallelFor(n, chunk, [&](std::size_t begin, std::size_t end, int)
+        {
+            for(std::size_t k = begin; k < end; ++k)
+            {
+                std::uint64_t game_seed = rng::Stream(seed, played + k).Next();
+                for(int v = 0; v < 2; ++v)
+                {
+                    with_variant(variants[v], [&](auto& s) { shots[v][k] = shots_to_win(s, game_seed); });
+                }
+            }
+        });
+        played += n;
+        for(std::size_t k = 0; k < n && outcome == sprt_running; ++k)
+        {
+            if(shots[0][k] < 0 || shots[1][k] < 0)
+            {
+                aborted++;
+                continue;
+            }
+            outcome = test.Add(shots[0][k], shots[1][k]);
+        }
+    }
+    if(outcome == sprt_running) outcome = sprt_limit;
+    auto t1 = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+
+    // print the report
+    double sd   = std::sqrt(test.Variance());
+    double se   = sd / std::sqrt(static_cast<double>(std::max(test.Pairs(), 1L)));
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "    seed            : " << seed << '\n';
+    std::cout << "    candidate       : " << variants[0].label << '\n';
+    std::cout << "    baseline        : " << variants[1].label << '\n';
+    std::cout << "    threads         : " << pool.Size() << '\n';
+    std::cout << "    margin          : " << delta << " shots (alpha " << alpha << ", beta " << beta << ")\n";
+    std::cout << "    verdict         : " << sprt_verdict[outcome] << '\n';
+    std::cout << "    games consumed  : " << 2 * test.Pairs() << " (" << test.Pairs() << " pairs, "
+              << 2 * played << " played, " << aborted << " aborted pairs)\n";
+    std::cout << "    elapsed         : " << seconds << " s\n";
+    std::cout << "    shots to win    : candidate " << test.MeanCandidate() << ", baseline " << test.MeanBaseline() << '\n';
+    std::cout << "    effect size     : " << test.Mean() << " shots saved, 95 % [" << test.Mean() - 1.96 * se << ", " << test.Mean() + 1.96 * se << "]";
+    if(test.MeanBaseline() > 0.) std::cout << ", " << 100. * test.Mean() / test.MeanBaseline() << " %";
+    if(sd > 0.) std::cout << ", d = " << test.Mean() / sd;
+    std::cout << '\n';
+    std::cout << "    llr             : candidate " << test.Llr(0) << ", baseline " << test.Llr(1)
+              << " (bounds " << test.Lower() << ", " << test.Upper() << ")\n";
+    std::cout << std::endl;
+    // program end
+    return 0;
+}
\ No newline at end of file
@@ -44,17 +44,15 @@
 #include <sstream>
 #include <iomanip>
 #include <numeric>
+#include <cstdlib>
+#include <cstring>
 #include "battleship.hpp"
 #include "functions.hpp"
 #include "vt100.hpp"
 
 // battlefield figure
 //******************************************************************************
-#define BOARD_ROWS 12
-#define BOARD_COLS 70
-
-//------------------------------------------------------------------------------
-char battle_board[BOARD_ROWS][BOARD_COLS] = 
+const char battle_board[BOARD_ROWS][BOARD_COLS] = 
 {
  //         1         2         3         4         5         6          
  //123456789012345678901234567890123456789012345678901234567890123456789 
@@ -76,9 +74,12 @@ char battle_board[BOARD_ROWS][BOARD_COLS] =
 //******************************************************************************
 // initialization
 //------------------------------------------------------------------------------
-battleship::battleship()
-: _error_condition(0), _initialized(false), _user(), _computer(), _quit_flag(false)
-{}
+battleship::battleship(std::istream& in, std::ostream& out)
+: _in(in), _out(out), _error_condition(0), _initialized(false), _user(in, out), _computer(make_strategy(strategy_classic)), _strategy(strategy_classic), _engine(_user, _computer.Player()),
+  _renderer(BOARD_ROWS, BOARD_COLS - 1, out), _phase(phase_over), _ship(empty_idx), _seed(0), _recording(false), _replay_log(nullptr)
+{
+  std::memcpy(_board, battle_board, sizeof(_board));
+}
 
 // gui
 //------------------------------------------------------------------------------
@@ -86,105 +87,160 @@ void battleship::Welcome() const
 {
   if(_error_condition == 0)
   {
-    std::cout << '\n';  
-    std::cout << "    * * * * * * * * * * * * * * * * * * * *\n";  
-    std::cout << "    *                                     *\n";  
-    std::cout << "    *    B A T T L E S H I P  G A M E     *\n";
-    std::cout << "    *                                     *\n";  
-    std::cout << "    * * * * * * * * * * * * * * * * * * * *\n";  
-    std::cout << '\n';
-    std::cout << "    vesion 1.0                      \n";
-    std::cout << '\n';
-    std::cout << "    by Marco & Samuele Bontempi     \n";
-    std::cout << std::endl;
+    _out << '\n';  
+    _out << "    * * * * * * * * * * * * * * * * * * * *\n";  
+    _out << "    *                                     *\n";  
+    _out << "    *    B A T T L E S H I P  G A M E     *\n";
+    _out << "    *                                     *\n";  
+    _out << "    * * * * * * * * * * * * * * * * * * * *\n";  
+    _out << '\n';
+    _out << "    vesion 1.0                      \n";
+    _out << '\n';
+    _out << "    by Marco & Samuele Bontempi     \n";
+    _out << std::endl;
   }
 }
 
 // game board initialization
 //------------------------------------------------------------------------------
 void battleship::InitBoard()
+{
+  std::string token;
+  Start();
+  // wait for the user grid
+  while((_phase == phase_setup || _phase == phase_manual) && _in >> token) Feed(token);
+}
+
+// game play
+//------------------------------------------------------------------------------
+void battleship::Play()
+{
+  std::string token;
+  while(!Over() && _in >> token) Feed(token);
+}
+
+// game play (input driven)
+//------------------------------------------------------------------------------
+void battleship::Start()
 {
   // reset boards
   _user.Reset();
-  _computer.Reset();
+  _computer.Player().Reset();
+  _engine.Reset();
+  std::memcpy(_board, battle_board, sizeof(_board));
+  // seed the game
+  _seed = thread_rng().Next();
+  rng game_rng(_seed);
+  _user.Seed(game_rng.Next());
+  _computer.Player().Seed(game_rng.Next());
   // initialize computer
-  _initialized &= _computer.InitRandom();
-  // initialize human
-  while(1)
-  {
-    std::string ans = ask("Choose manual or automatic grid initialization (m, a)");
-    if(ans.size() == 1)
-    {
-      if(ans[0] == 'a' || ans[0] == 'A')
-      {
-        _initialized = _UserAutoInit();
-        return;
-      }
-      if(ans[0] == 'm' || ans[0] == 'M')
-      {
-        _initialized = _UserManualInit();
-        return;
-      }
-    }
-  }
+  _initialized = _computer.Place();
+  // ask for the human initialization
+  _phase = phase_setup;
+  prompt("Choose manual or automatic grid initialization (m, a)", _out);
 }
 
-// game play
 //------------------------------------------------------------------------------
-void battleship::Play()
+bool battleship::Feed(const std::string& token)
 {
-  if(IsInitialized())
+  std::string ans = token;
+  switch(_phase)
   {
-    std::string pos;
-    char mark;
-    while(true)
-    {
-      // user turn
-      _UpdateBoard();
-      pos  = _user.Fire();
-      if(pos == "menu")
-      {
-        _RunMenu();
-        // exit the game
-        if(_quit_flag) break;
-        // re-ask input
-        continue;
-      }
-      mark = _computer.CheckShot(pos);
-      _user.SetTargetGrid(pos, mark);
-      if(_user.End())
+    case phase_setup:
+      if(ans == "a" || ans == "A")
       {
-        Winner("User");
-        break;
+        _initialized = _UserAutoInit() && _initialized;
+        _EnterFire();
       }
-      // computer turn
-      _UpdateBoard();
-      pos  = _computer.Fire();
-      mark = _user.CheckShot(pos);
-      _computer.SetTargetGrid(pos, mark);
-      if(_computer.End())
+      else if(ans == "m" || ans == "M")
       {
-        Winner("Computer");
-        break;
+        _phase = phase_manual;
+        _ship  = carrier_idx;
+        _AskShip();
       }
-    }
-  }
-  else
-  {
-    std::cerr << "The battlefield was not initialized. Game aborted." << std::endl;
+      else prompt("Choose manual or automatic grid initialization (m, a)", _out);
+      break;
+    case phase_manual:
+      // the next ship, or the same ship again
+      if(_TakeShip(ans) && ++_ship > destroier_idx) _EnterFire();
+      else                                          _AskShip();
+      break;
+    case phase_fire:
+      _TakeFire(ans);
+      break;
+    case phase_menu:
+      _TakeMenu(ans);
+      break;
+    case phase_menu_ack:
+      _PrintMenu();
+      break;
+    case phase_save:
+      _SaveGame(ans);
+      break;
+    case phase_load:
+      _LoadGame(ans);
+      break;
   }
+  return !Over();
 }
 
 // end game
 //------------------------------------------------------------------------------
 void battleship::Winner(const std::string& name)
 {
+  if(_replay_log && _recording) _replay_log->Append(_replay);
   _UpdateBoard();
-  std::cout << "\n\n\n\n";
-  std::cout << "***\n";
-  std::cout << "*** The winner is: " << name << "!!! ***\n";
-  std::cout << "***\n";
-  std::cout << "\n\n\n\n" << std::endl;
+  _out << "\n\n\n\n";
+  _out << "***\n";
+  _out << "*** The winner is: " << name << "!!! ***\n";
+  _out << "***\n";
+  _out << "\n\n\n\n" << std::endl;
+}
+
+// snapshot
+//------------------------------------------------------------------------------
+void battleship::Save(game_snapshot& snap) const noexcept
+{
+  snap.magic    = snapshot_magic;
+  snap.version  = snapshot_version;
+  snap.size     = sizeof(game_snapshot);
+  snap.reserved = 0;
+  snap.seed     = _seed;
+  _user.GetState(snap.user);
+  _computer.Player().GetState(snap.computer);
+  // the strategy and, for a computer, its targeting state
+  std::memset(&snap.ai, 0, sizeof(snap.ai));
+  if(const computer* ai = _computer.Computer()) ai->GetState(snap.ai);
+  snap.ai.level = _strategy;
+  _engine.GetState(snap.engine);
+}
+
+//------------------------------------------------------------------------------
+void battleship::Restore(const game_snapshot& snap) noexcept
+{
+  _seed = snap.seed;
+  _user.SetState(snap.user);
+  if(snap.ai.level != _strategy) SetOpponent(snap.ai.level);
+  _computer.Player().SetState(snap.computer);
+  if(computer* ai = _computer.Computer()) ai->SetState(snap.ai);
+  _engine.SetState(snap.engine);
+  _initialized = _user.IsInitialized() && _computer.Player().IsInitialized();
+  // rebuild the battleboard from the grids
+  std::memcpy(_board, battle_board, sizeof(_board));
+  _renderer.Invalidate();
+  // the shots before the snapshot are not known
+  _recording = false;
+}
+
+//------------------------------------------------------------------------------
+bool battleship::SetOpponent(int strategy)
+{
+  any_strategy opponent = make_strategy(strategy);
+  if(!opponent) return false;
+  _computer = std::move(opponent);
+  _strategy = strategy;
+  _engine   = engine(_user, _computer.Player());
+  return true;
 }
 
 // auxiliary functions
@@ -203,7 +259,7 @@ void battleship::_SetOceanGrid(int row, int col, char mark)
 //    if(mark == miss)
 //      battle_board[bb_row][bb_col] = '.';
 //    else
-      battle_board[bb_row][bb_col] = mark;
+      _board[bb_row][bb_col] = mark;
   }
 }
 
@@ -216,7 +272,7 @@ void battleship::_SetTargetGrid(int row, int col, char mark)
   char empty = ship_mark[empty_idx];
   int bb_row =  1 + row;
   int bb_col = 47 + 2 * col;
-  if(mark != empty) battle_board[bb_row][bb_col] = mark;
+  if(mark != empty) _board[bb_row][bb_col] = mark;
 }
 
 //------------------------------------------------------------------------------
@@ -230,16 +286,11 @@ void battleship::_UpdateBoard()
     {
       _SetOceanGrid( i, j, _user.GetOceanGrid(i, j));      // compile ocean grid
       _SetTargetGrid(i, j, _user.GetTargetGrid(i, j));     // compile target grid
-      _SetOceanGrid( i, j, _computer.GetTargetGrid(i, j)); // overlap computer target grid
+      _SetOceanGrid( i, j, _computer.Player().GetTargetGrid(i, j)); // overlap computer target grid
     }
   }
-  // print the battleboard
-  std::cout << clear_screen;
-  for(int i = 0; i < BOARD_ROWS; ++i)
-  {
-    std::cout << battle_board[i] << '\n';
-  }
-  std::cout << std::endl;
+  // print the changes of the battleboard
+  _renderer.Draw(_board[0], BOARD_COLS);
 }
 
 //------------------------------------------------------------------------------
@@ -249,94 +300,213 @@ bool battleship::_UserAutoInit()
 }
 
 //------------------------------------------------------------------------------
-bool battleship::_UserManualInit()
-{  
+void battleship::_AskShip()
+{
   std::stringstream msg;
-  int  s, N = ship_mark.size();
-  std::string pos;
-  int  dir;
-  std::string ans;
-  bool init = false;
+  _UpdateBoard();
+  // ask for ship position
+  msg << "\n\n\n\nChoose " << ship_name[_ship] << " (" << ship_size[_ship] << ") position and direction";
+  prompt(msg.str(), _out);
+}
 
-  // loop ships
-  for(s = 1; s < N; ++s)
-  {  
-    while(1)
-    {
-      _UpdateBoard();
-      // ask for ship position
-      msg.str("");
-      msg << "\n\n\n\nChoose " << ship_name[s] << " (" << ship_size[s] << ") position and direction";
-      ans = ask(msg.str());
-      // get position substring
-      pos = ans.substr(0, ans.size() - 1);
-      // parse direction
-      switch(*(ans.end() - 1))
-      {
-        case 'l': dir = dir_left;  break;
-        case 'r': dir = dir_right; break;
-        case 'u': dir = dir_up;    break;
-        case 'd': dir = dir_down;  break;
-      }
-      // initialize the ship
-      init = _user.InitShip(s, pos, dir);
-      // check if the initialization is successfull
-      if(init) break;
-    }
+//------------------------------------------------------------------------------
+bool battleship::_TakeShip(const std::string& ans)
+{
+  // get position substring
+  std::string pos = ans.substr(0, ans.size() - 1);
+  int dir = 0;
+  // parse direction
+  switch(ans.empty() ? '\0' : ans.back())
+  {
+    case 'l': dir = dir_left;  break;
+    case 'r': dir = dir_right; break;
+    case 'u': dir = dir_up;    break;
+    case 'd': dir = dir_down;  break;
   }
-  return true;
+  // initialize the ship
+  return _user.InitShip(_ship, pos, dir);
 }
 
 //------------------------------------------------------------------------------
-void battleship::_RunMenu() noexcept
+void battleship::_EnterFire()
 {
-  // initialize the answer
-  int ans = 0;
-  // start a loop
-  while(1)
+  // start recording a new game
+  if(_phase == phase_setup || _phase == phase_manual)
   {
-    // print the menu
-    std::cout << clear_screen;
-    std::cout << "\n\n\n\n";
-    std::cout << "    ----------------------------------------------\n";
-    std::cout << "    Main Menu:\n";
-    std::cout << "    ----------------------------------------------\n";
-    std::cout << "    \n";
-    std::cout << "    1) statistics\n";
-    std::cout << "    2) info\n";
-    std::cout << "    3) return to game\n";
-    std::cout << "    4) reset game\n";
-    std::cout << "    5) quit game\n";
-    std::cout << "    \n";
-    std::cout << "    ----------------------------------------------\n";
-    std::cout << "    \n";
-    std::cout << "    select funtction: ";
-    std::cin >> ans;
-    // select the answer
-    switch(ans)
+    if(!IsInitialized())
     {
-      case 1: // statistics
-        _Statistics();
-        ask("return to main menu (ok)");
-        break;
-      case 2: // info
-        Welcome();
-        ask("return to main menu (ok)");
-        break;
-      case 3: // return to game
-        return;
-        break;
-      case 4: // reset game
-        InitBoard();
-        return;
-        break;
-      case 5: // quit game
-        _quit_flag = true;
-        std::cout << clear_screen;
-        return;
-        break;
+      _out << "The battlefield was not initialized. Game aborted." << std::endl;
+      _phase = phase_over;
+      return;
     }
+    _replay.Start(_seed, _user, _computer.Player());
+    _recording = true;
+  }
+  // a restored game can be over or at the computer turn
+  if(_engine.End())
+  {
+    Winner((_engine.Winner() == first_side) ? "User" : "Computer");
+    _phase = phase_over;
+    return;
+  }
+  if(_engine.Turn() != first_side)
+  {
+    _ComputerFire();
+    return;
+  }
+  // ask the user shot
+  _phase = phase_fire;
+  _UpdateBoard();
+  _user.AskFire();
+}
+
+//------------------------------------------------------------------------------
+void battleship::_TakeFire(std::string& ans)
+{
+  // ask again a non-valid input
+  if(!_user.TakeFire(ans)) return;
+  if(ans == "menu")
+  {
+    _phase = phase_menu;
+    // the menu overwrites the battleboard
+    _renderer.Invalidate();
+    _PrintMenu();
+    return;
+  }
+  // user turn
+  step_result res = _engine.Step(ans);
+  _replay.Add(res);
+  // re-ask a non-valid shot
+  if(res.outcome == shot_invalid)
+  {
+    _EnterFire();
+    return;
+  }
+  if(res.end)
+  {
+    Winner("User");
+    _phase = phase_over;
+    return;
+  }
+  _ComputerFire();
+}
+
+//------------------------------------------------------------------------------
+void battleship::_ComputerFire()
+{
+  _UpdateBoard();
+  step_result res = _engine.Step(_computer.FireCell());
+  // no cell left to fire: the turn would stay to the computer
+  if(res.outcome == shot_invalid)
+  {
+    _out << "The computer has no valid shot. Game aborted." << std::endl;
+    _phase = phase_over;
+    return;
+  }
+  _replay.Add(res);
+  if(res.end)
+  {
+    Winner("Computer");
+    _phase = phase_over;
+    return;
   }
+  _EnterFire();
+}
+
+//------------------------------------------------------------------------------
+void battleship::_PrintMenu() noexcept
+{
+  _phase = phase_menu;
+  _out << clear_screen;
+  _out << "\n\n\n\n";
+  _out << "    ----------------------------------------------\n";
+  _out << "    Main Menu:\n";
+  _out << "    ----------------------------------------------\n";
+  _out << "    \n";
+  _out << "    1) statistics\n";
+  _out << "    2) info\n";
+  _out << "    3) return to game\n";
+  _out << "    4) reset game\n";
+  _out << "    5) quit game\n";
+  _out << "    6) save game\n";
+  _out << "    7) load game\n";
+  _out << "    \n";
+  _out << "    ----------------------------------------------\n";
+  _out << "    \n";
+  _out << "    select funtction: ";
+  _out.flush();
+}
+
+//------------------------------------------------------------------------------
+void battleship::_TakeMenu(const std::string& ans) noexcept
+{
+  // select the answer
+  switch(std::atoi(ans.c_str()))
+  {
+    case 1: // statistics
+      _Statistics();
+      prompt("return to main menu (ok)", _out);
+      _phase = phase_menu_ack;
+      break;
+    case 2: // info
+      Welcome();
+      prompt("return to main menu (ok)", _out);
+      _phase = phase_menu_ack;
+      break;
+    case 3: // return to game
+      _EnterFire();
+      break;
+    case 4: // reset game
+      Start();
+      break;
+    case 5: // quit game
+      _Quit();
+      break;
+    case 6: // save game
+      prompt("save to file", _out);
+      _phase = phase_save;
+      break;
+    case 7: // load game
+      prompt("load from file", _out);
+      _phase = phase_load;
+      break;
+    default:
+      _PrintMenu();
+  }
+}
+
+//------------------------------------------------------------------------------
+void battleship::_Quit() noexcept
+{
+  if(_replay_log && _recording) _replay_log->Append(_replay);
+  _out << clear_screen;
+  _phase = phase_over;
+}
+
+//------------------------------------------------------------------------------
+void battleship::_SaveGame(const std::string& path) noexcept
+{
+  game_snapshot snap;
+  Save(snap);
+  if(save_snapshot(path, snap))
+    prompt("game saved (ok)", _out);
+  else
+    prompt("the game was not saved (ok)", _out);
+  _phase = phase_menu_ack;
+}
+
+//------------------------------------------------------------------------------
+void battleship::_LoadGame(const std::string& path) noexcept
+{
+  game_snapshot snap;
+  if(load_snapshot(path, snap))
+  {
+    Restore(snap);
+    prompt("game loaded (ok)", _out);
+  }
+  else
+    prompt("not a valid saved game (ok)", _out);
+  _phase = phase_menu_ack;
 }
 
 //------------------------------------------------------------------------------
@@ -344,18 +514,19 @@ void battleship::_Statistics() noexcept
 {
   int total_ships = std::accumulate(ship_size.begin(), ship_size.end(), 0);
   int usr_empty = _user.CountTargetEmpty(),    usr_miss = _user.CountTargetMiss(),    usr_hit = _user.CountTargetHit(),    usr_all = (100 * usr_hit) / total_ships;
-  int  pc_empty = _computer.CountTargetEmpty(), pc_miss = _computer.CountTargetMiss(), pc_hit = _computer.CountTargetHit(), pc_all = (100 * pc_hit)  / total_ships;
+  const player& opponent = _computer.Player();
+  int  pc_empty = opponent.CountTargetEmpty(), pc_miss = opponent.CountTargetMiss(), pc_hit = opponent.CountTargetHit(), pc_all = (100 * pc_hit)  / total_ships;
 
   // print the table
-  std::cout << clear_screen;
-  std::cout << "\n\n";
-  std::cout << "               |    empty   |   miss   |   hit   |   overall performance   \n";
-  std::cout << "    =======================================================================\n";
-  std::cout << "               |            |          |         |                         \n";
-  std::cout << "    User       |    " << std::setw(5) << usr_empty << "   |   " << std::setw(4) << usr_miss << "   |   " << std::setw(3) << usr_hit << "   |   " << std::setw(17) << usr_all << " % \n";
-  std::cout << "               |            |          |         |                         \n";
-  std::cout << "    Computer   |    " << std::setw(5) << pc_empty  << "   |   " << std::setw(4) << pc_miss  << "   |   " << std::setw(3) << pc_hit  << "   |   " << std::setw(17) << pc_all  << " % \n";
-  std::cout << "               |            |          |         |                         \n";
-  std::cout << "    =======================================================================\n";
-  std::cout << '\n' << std::endl;
+  _out << clear_screen;
+  _out << "\n\n";
+  _out << "               |    empty   |   miss   |   hit   |   overall performance   \n";
+  _out << "    =======================================================================\n";
+  _out << "               |            |          |         |                         \n";
+  _out << "    User       |    " << std::setw(5) << usr_empty << "   |   " << std::setw(4) << usr_miss << "   |   " << std::setw(3) << usr_hit << "   |   " << std::setw(17) << usr_all << " % \n";
+  _out << "               |            |          |         |                         \n";
+  _out << "    Computer   |    " << std::setw(5) << pc_empty  << "   |   " << std::setw(4) << pc_miss  << "   |   " << std::setw(3) << pc_hit  << "   |   " << std::setw(17) << pc_all  << " % \n";
+  _out << "               |            |          |         |                         \n";
+  _out << "    =======================================================================\n";
+  _out << '\n' << std::endl;
 }
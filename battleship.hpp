@@ -44,13 +44,49 @@
 
 #include "user.hpp"
 #include "computer.hpp"
+#include "engine.hpp"
+#include "renderer.hpp"
+#include "replay.hpp"
+#include "snapshot.hpp"
+#include "strategy.hpp"
+#include <iostream>
+
+// battlefield figure size
+#define BOARD_ROWS 12
+#define BOARD_COLS 70
+
+// game phases (the input the game is waiting for)
+//------------------------------------------------------------------------------
+enum game_phase
+{
+    phase_setup = 0, // manual or automatic grid initialization
+    phase_manual,    // position and direction of the next user ship
+    phase_fire,      // user shot or "menu"
+    phase_menu,      // menu function
+    phase_menu_ack,  // return to the menu
+    phase_save,      // snapshot file to save
+    phase_load,      // snapshot file to load
+    phase_over       // game over
+};
 
 // battleship class
+//
+// One game session. All the session state (players, engine, battleboard
+// frame and terminal) belongs to the instance and the I/O goes through the
+// given streams only, so independent instances can run concurrently on
+// different threads. An instance is driven by one thread at a time.
+//
+// The game is input driven: Start() opens a game and prints the first prompt,
+// each Feed() takes one input token, advances the game and prints the next
+// prompt. Nothing waits for input, so a driver (terminal, socket, script) can
+// interleave many games on one thread. InitBoard() and Play() are the blocking
+// drivers on the input stream.
+//
 class battleship
 {
     public:
         // initialization
-        battleship();
+        battleship(std::istream& in = std::cin, std::ostream& out = std::cout);
         bool IsInitialized() { return _initialized; }
 
         // gui
@@ -62,9 +98,25 @@ class battleship
         // game play
         void Play();
 
+        // game play (input driven)
+        void Start();
+        bool Feed(const std::string& token); // false once the game is over
+        int  inline Phase() const noexcept { return _phase; }
+        bool inline Over()  const noexcept { return _phase == phase_over; }
+
         // end game
         void Winner(const std::string& name); 
 
+        // replay log of the played games (nullptr = no log)
+        void inline SetReplayLog(replay_writer* log) noexcept { _replay_log = log; }
+
+        // computer strategy (strategy_index), applied from the next game
+        bool SetOpponent(int strategy);
+
+        // snapshot of the current game
+        void Save(game_snapshot& snap) const noexcept;
+        void Restore(const game_snapshot& snap) noexcept;
+
     private:
         // auxiliary functions
         void _SetOceanGrid(int row, int col, char mark);
@@ -72,17 +124,36 @@ class battleship
         void _UpdateBoard();
         
         bool _UserAutoInit();
-        bool _UserManualInit();
+        void _AskShip();
+        bool _TakeShip(const std::string& ans);
 
-        void _RunMenu()   noexcept;
+        void _EnterFire();
+        void _TakeFire(std::string& ans);
+        void _ComputerFire();
+        void _PrintMenu()  noexcept;
+        void _TakeMenu(const std::string& ans) noexcept;
+        void _Quit()       noexcept;
         void _Statistics() noexcept;
+        void _SaveGame(const std::string& path) noexcept;
+        void _LoadGame(const std::string& path) noexcept;
 
         // instance variables
-        int      _error_condition;
-        bool     _initialized;
-        user     _user;
-        computer _computer;
-        bool     _quit_flag;
+        std::istream&  _in;
+        std::ostream&  _out;
+        int            _error_condition;
+        bool           _initialized;
+        user           _user;
+        any_strategy   _computer;   // computer strategy
+        int            _strategy;   // strategy_index of _computer
+        engine         _engine;
+        char           _board[BOARD_ROWS][BOARD_COLS]; // battleboard frame
+        renderer       _renderer;
+        int            _phase;      // game_phase
+        int            _ship;       // next ship of the manual initialization
+        std::uint64_t  _seed;       // game seed
+        replay_game    _replay;     // current game record
+        bool           _recording;  // false for restored games (no shot record)
+        replay_writer* _replay_log; // game log (not owned)
 };
 
 #endif /* __BATTLESHIP_HPP__ */
\ No newline at end of file
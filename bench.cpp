@@ -0,0 +1,413 @@
+//==============================================================================
+//
+// bench.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Engine micro- and macro-benchmarks
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "computer.hpp"
+#include "engine.hpp"
+#include "functions.hpp"
+#include "snapshot.hpp"
+#include "tally.hpp"
+
+// benchmark helpers
+//******************************************************************************
+// optimization barrier: the value is assumed to be read
+template<class T>
+void inline keep(const T& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// benchmark players
+//------------------------------------------------------------------------------
+//
+// expose the protected methods under test
+//
+class bench_player : public player
+{
+    public:
+        bench_player() : player("bench") {}
+        using player::_ParsePosition;
+};
+
+class bench_computer : public computer
+{
+    public:
+        bench_computer(int level = ai_classic) : computer(level) {}
+        void inline HitMode(int row, int col) noexcept { _SetHitModeON(row, col); }
+};
+
+// benchmark case structure
+//------------------------------------------------------------------------------
+//
+// body(n) runs n operations of the case
+//
+struct bench_case
+{
+    std::string                name;
+    std::string                unit; // operation
+    std::function<void(long)>  body;
+};
+
+// benchmark result structure
+//------------------------------------------------------------------------------
+struct bench_result
+{
+    std::string name;
+    std::string unit;
+    long        iterations = 0; // operations per repetition
+    double      mean = 0, stddev = 0, min = 0, median = 0, max = 0; // ns per operation
+    double      inline Cv() const noexcept { return (mean > 0) ? 100.0 * stddev / mean : 0; }
+};
+
+// benchmark functions
+//******************************************************************************
+double time_batch(const bench_case& bc, long n)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    bc.body(n);
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count();
+}
+
+//------------------------------------------------------------------------------
+//
+// calibrate the batch to the repetition time, warm up, then time the
+// repetitions
+//
+bench_result run_case(const bench_case& bc, double rep_ns, int warmup, int reps)
+{
+    bench_result res;
+    res.name = bc.name;
+    res.unit = bc.unit;
+    // calibration
+    long n = 1;
+    double t = time_batch(bc, n);
+    while(t < rep_ns && n < (1L << 40))
+    {
+        n = (t < rep_ns / 100) ? n * 10 : static_cast<long>(n * 1.2 * rep_ns / std::max(t, 1.0)) + 1;
+        t = time_batch(bc, n);
+    }
+    res.iterations = n;
+    // warm-up
+    for(int r = 0; r < warmup; ++r) time_batch(bc, n);
+    // repetitions
+    std::vector<double> ns(reps);
+    for(int r = 0; r < reps; ++r) ns[r] = time_batch(bc, n) / n;
+    double sum = 0, sq = 0;
+    for(double x : ns) sum += x;
+    res.mean = sum / reps;
+    for(double x : ns) sq += (x - res.mean) * (x - res.mean);
+    res.stddev = (reps > 1) ? std::sqrt(sq / (reps - 1)) : 0;
+    std::sort(ns.begin(), ns.end());
+    res.min    = ns.front();
+    res.max    = ns.back();
+    res.median = (reps % 2) ? ns[reps / 2] : 0.5 * (ns[reps / 2 - 1] + ns[reps / 2]);
+    return res;
+}
+
+// report functions
+//******************************************************************************
+//
+// JSON report: one benchmark object per line, so that a baseline can be read
+// back without a JSON parser
+//
+bool write_json(const std::string& path, const std::vector<bench_result>& results,
+                std::uint64_t seed, int warmup, int reps, double rep_ms)
+{
+    std::ofstream out(path);
+    if(!out) return false;
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"seed\": " << seed << ",\n";
+    out << "  \"warmup\": " << warmup << ",\n";
+    out << "  \"repetitions\": " << reps << ",\n";
+    out << "  \"repetition_ms\": " << rep_ms << ",\n";
+#if defined(__VERSION__)
+    out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+    out << "  \"benchmarks\": [\n";
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+        const bench_result& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", \"iterations\": " << r.iterations
+            << ", \"mean_ns\": " << r.mean << ", \"stddev_ns\": " << r.stddev << ", \"min_ns\": " << r.min
+            << ", \"median_ns\": " << r.median << ", \"max_ns\": " << r.max << ", \"cv_percent\": " << r.Cv() << "}"
+            << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+    return static_cast<bool>(out);
+}
+
+//------------------------------------------------------------------------------
+//
+// median per benchmark name of a report written by write_json
+//
+bool read_baseline(const std::string& path, std::map<std::string, double>& median)
+{
+    std::ifstream in(path);
+    if(!in) return false;
+    std::string line;
+    const std::string name_key = "{\"name\": \"", median_key = "\"median_ns\": ";
+    while(std::getline(in, line))
+    {
+        std::size_t n = line.find(name_key), m = line.find(median_key);
+        if(n == std::string::npos || m == std::string::npos) continue;
+        n += name_key.size();
+        std::size_t e = line.find('"', n);
+        if(e == std::string::npos) continue;
+        median[line.substr(n, e - n)] = std::atof(line.c_str() + m + median_key.size());
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_bench [-f filter] [-w warmup] [-r reps] [-T ms] [-s seed] [-j json] [-c baseline]\n";
+    std::cout << "\n";
+    std::cout << "    -f filter    run only the benchmarks whose name contains filter\n";
+    std::cout << "    -w warmup    warm-up repetitions (default 3)\n";
+    std::cout << "    -r reps      timed repetitions (default 10)\n";
+    std::cout << "    -T ms        time of one repetition in milliseconds (default 50)\n";
+    std::cout << "    -s seed      seed of the boards and games (default 1)\n";
+    std::cout << "    -j json      write the results as JSON\n";
+    std::cout << "    -c baseline  compare the medians with a JSON report of a previous run\n";
+    std::cout << std::endl;
+}
+
+// main
+//******************************************************************************
+int main(int argc, char* argv[])
+{
+    std::string   filter, json_path, baseline_path;
+    int           warmup = 3;
+    int           reps   = 10;
+    double        rep_ms = 50;
+    std::uint64_t seed   = 1;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-f") && i + 1 < argc)      filter        = argv[++i];
+        else if(!std::strcmp(argv[i], "-w") && i + 1 < argc) warmup        = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-r") && i + 1 < argc) reps          = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-T") && i + 1 < argc) rep_ms        = std::atof(argv[++i]);
+        else if(!std::strcmp(argv[i], "-s") && i + 1 < argc) seed          = std::strtoull(argv[++i], nullptr, 10);
+        else if(!std::strcmp(argv[i], "-j") && i + 1 < argc) json_path     = argv[++i];
+        else if(!std::strcmp(argv[i], "-c") && i + 1 < argc) baseline_path = argv[++i];
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if(warmup < 0 || reps < 1 || rep_ms <= 0)
+    {
+        usage();
+        return 1;
+    }
+    std::map<std::string, double> baseline;
+    if(!baseline_path.empty() && !read_baseline(baseline_path, baseline))
+    {
+        std::cerr << "cannot read the baseline " << baseline_path << std::endl;
+        return 1;
+    }
+
+    // fixtures
+    rng seeds(seed);
+    bench_player board;                          // placed fleet, no shots
+    board.Seed(seeds.Next());
+    board.InitRandom();
+    game_snapshot fresh;
+    board.GetState(fresh.user);
+    bench_player played = board;                 // half of the ocean targeted
+    std::vector<int> order(field_cells);
+    for(int k = 0; k < field_cells; ++k) order[k] = k;
+    for(int k = field_cells - 1; k > 0; --k) std::swap(order[k], order[seeds.Below(k + 1)]);
+    for(int k = 0; k < field_cells / 2; ++k) played.SetTargetGrid(order[k], (k % 4) ? shot_mark[empty_idx] : shot_mark[hit_idx]);
+    if(played.CountTargetMiss() + played.CountTargetHit() != field_cells / 2)
+    {
+        std::cerr << "the targeted board fixture is not half targeted" << std::endl;
+        return 1;
+    }
+    std::vector<std::string> cells;              // every position, row major
+    for(int r = 0; r < FIELD_ROWS; ++r)
+        for(int c = 0; c < FIELD_COLS; ++c)
+            cells.push_back(std::string(1, static_cast<char>('A' + c)) + std::to_string(r + 1));
+    bench_computer hunter;                       // random mode
+    hunter.Seed(seeds.Next());
+    bench_computer follower;                     // hit mode around d5
+    follower.Seed(seeds.Next());
+    follower.HitMode(4, 3);
+
+    // benchmark cases
+    std::vector<bench_case> cases =
+    {
+        { "player::InitShip", "fleet (reset + 5 ships)", [&board](long n)
+            {
+                static const char* pos[] = { "", "A1", "A3", "A5", "A7", "A9" };
+                for(long i = 0; i < n; ++i)
+                {
+                    board.Reset();
+                    for(int s = carrier_idx; s <= destroier_idx; ++s)
+                    {
+                        std::string p = pos[s];
+                        keep(board.InitShip(s, p, dir_right));
+                    }
+                }
+            } },
+        { "player::InitRandom", "fleet (reset + random fleet)", [&board](long n)
+            {
+                for(long i = 0; i < n; ++i)
+                {
+                    board.Reset();
+                    keep(board.InitRandom());
+                }
+            } },
+        { "player::CheckShot", "shot", [&board, &cells, &fresh](long n)
+            {
+                board.SetState(fresh.user);
+                for(long i = 0; i < n; ++i) keep(board.CheckShot(cells[i % field_cells]));
+            } },
+        { "player::CheckShot (cell)", "shot", [&board, &fresh](long n)
+            {
+                board.SetState(fresh.user);
+                for(long i = 0; i < n; ++i) keep(board.CheckShot(static_cast<int>(i % field_cells)));
+            } },
+        { "player::_ParsePosition", "position", [&board, &cells](long n)
+            {
+                for(long i = 0; i < n; ++i) keep(board._ParsePosition(cells[i % field_cells]));
+            } },
+        { "player::CountTarget*", "empty + miss + hit", [&played](long n)
+            {
+                for(long i = 0; i < n; ++i)
+                {
+                    int count = played.CountTargetEmpty() + played.CountTargetMiss() + played.CountTargetHit();
+                    keep(count);
+                }
+            } },
+        { "computer::Fire (random)", "shot", [&hunter](long n)
+            {
+                for(long i = 0; i < n; ++i) keep(hunter.Fire());
+            } },
+        { "computer::Fire (hit mode)", "shot", [&follower](long n)
+            {
+                for(long i = 0; i < n; ++i) keep(follower.Fire());
+            } },
+        { "computer::FireCell (random)", "shot", [&hunter](long n)
+            {
+                for(long i = 0; i < n; ++i) keep(hunter.FireCell());
+            } },
+        { "rand01", "draw", [](long n)
+            {
+                for(long i = 0; i < n; ++i) keep(rand01());
+            } },
+        { "game (classic vs classic)", "game", [seed](long n)
+            {
+                static std::uint64_t id = 0;
+                for(long i = 0; i < n; ++i)
+                {
+                    rng game_rng = rng::Stream(seed, id++);
+                    computer first, second;
+                    engine   game(first, second);
+                    first.Seed(game_rng.Next());
+                    second.Seed(game_rng.Next());
+                    first.InitRandom();
+                    second.InitRandom();
+                    for(int steps = 0; !game.End() && steps < max_game_shots(field_cells); ++steps)
+                    {
+                        game.Step((game.Turn() == first_side) ? first.FireCell() : second.FireCell());
+                    }
+                    keep(game.Winner());
+                }
+            } },
+    };
+
+    // run the benchmarks
+    std::vector<bench_result> results;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "    " << std::left << std::setw(28) << "benchmark" << std::right << std::setw(12) << "median ns"
+              << std::setw(12) << "mean ns" << std::setw(10) << "cv %" << std::setw(12) << "min ns";
+    if(!baseline.empty()) std::cout << std::setw(10) << "delta %";
+    std::cout << "   operation\n";
+    for(const bench_case& bc : cases)
+    {
+        if(!filter.empty() && bc.name.find(filter) == std::string::npos) continue;
+        bench_result r = run_case(bc, rep_ms * 1e6, warmup, reps);
+        results.push_back(r);
+        std::cout << "    " << std::left << std::setw(28) << r.name << std::right << std::setw(12) << r.median
+                  << std::setw(12) << r.mean << std::setw(10) << r.Cv() << std::setw(12) << r.min;
+        if(!baseline.empty())
+        {
+            auto it = baseline.find(r.name);
+            if(it != baseline.end() && it->second > 0)
+                std::cout << std::showpos << std::setw(10) << 100.0 * (r.median - it->second) / it->second << std::noshowpos;
+            else
+                std::cout << std::setw(10) << "-";
+        }
+        std::cout << "   " << r.unit << std::endl;
+    }
+
+    // export the results
+    if(!json_path.empty() && !write_json(json_path, results, seed, warmup, reps, rep_ms))
+    {
+        std::cerr << "cannot write " << json_path << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
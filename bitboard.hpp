@@ -0,0 +1,252 @@
+//==============================================================================
+//
+// bitboard.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Fixed-size cell sets used by the game engine
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __BITBOARD_HPP__
+#define __BITBOARD_HPP__
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// bit counting functions
+//------------------------------------------------------------------------------
+int inline popcount64(std::uint64_t x) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int inline ctz64(std::uint64_t x) noexcept // x must be non-zero
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return static_cast<int>(idx);
+#else
+    int n = 0;
+    while(!(x & 1)) { x >>= 1; ++n; }
+    return n;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int inline select64(std::uint64_t x, int k) noexcept // index of the k-th set bit (0-index)
+{
+    for(int i = 0; i < k; ++i) x &= x - 1;
+    return ctz64(x);
+}
+
+// bitboard structure
+//------------------------------------------------------------------------------
+//
+// set of 64 * Words cells. Cell indices are 0-index and row major:
+//
+// idx = row * cols + col
+//
+// cell idx is bit (idx % 64) of word w[idx / 64]. Every loop runs on a
+// compile-time number of words and is fully unrolled by the compiler.
+//
+template<int Words>
+struct basic_bitboard
+{
+    static constexpr int words = Words;
+    static constexpr int bits  = 64 * Words;
+
+    std::uint64_t w[Words];
+
+    // initialization
+    constexpr basic_bitboard() noexcept : w() {}
+
+    static constexpr basic_bitboard Bit(int idx) noexcept
+    {
+        basic_bitboard b;
+        b.w[idx >> 6] = 1ull << (idx & 63);
+        return b;
+    }
+
+    static constexpr basic_bitboard Fill(int n) noexcept // first n cells set
+    {
+        basic_bitboard b;
+        for(int i = 0; i < Words; ++i)
+        {
+            int m = n - 64 * i;
+            if(m >= 64)    b.w[i] = ~0ull;
+            else if(m > 0) b.w[i] = (1ull << m) - 1;
+        }
+        return b;
+    }
+
+    // cell access
+    constexpr bool Test(int idx) const noexcept { return (w[idx >> 6] >> (idx & 63)) & 1; }
+    void           Set(int idx)        noexcept { w[idx >> 6] |=  (1ull << (idx & 63)); }
+    void           Clear(int idx)      noexcept { w[idx >> 6] &= ~(1ull << (idx & 63)); }
+
+    // queries
+    constexpr bool Any() const noexcept
+    {
+        std::uint64_t x = 0;
+        for(int i = 0; i < Words; ++i) x |= w[i];
+        return x != 0;
+    }
+    constexpr bool None() const noexcept { return !Any(); }
+    int Count() const noexcept
+    {
+        int n = 0;
+        for(int i = 0; i < Words; ++i) n += popcount64(w[i]);
+        return n;
+    }
+    int Lowest() const noexcept // index of the lowest set cell, -1 if empty
+    {
+        for(int i = 0; i < Words; ++i)
+        {
+            if(w[i]) return 64 * i + ctz64(w[i]);
+        }
+        return -1;
+    }
+    int Select(int k) const noexcept // index of the k-th set cell (k < Count())
+    {
+        for(int i = 0; i < Words; ++i)
+        {
+            int n = popcount64(w[i]);
+            if(k < n) return 64 * i + select64(w[i], k);
+            k -= n;
+        }
+        return -1;
+    }
+    int PopLowest() noexcept // remove and return the lowest set cell
+    {
+        for(int i = 0; i < Words; ++i)
+        {
+            if(w[i])
+            {
+                int idx = 64 * i + ctz64(w[i]);
+                w[i] &= w[i] - 1;
+                return idx;
+            }
+        }
+        return -1;
+    }
+
+    // bitwise operators
+    constexpr basic_bitboard operator&(const basic_bitboard& b) const noexcept
+    {
+        basic_bitboard r;
+        for(int i = 0; i < Words; ++i) r.w[i] = w[i] & b.w[i];
+        return r;
+    }
+    constexpr basic_bitboard operator|(const basic_bitboard& b) const noexcept
+    {
+        basic_bitboard r;
+        for(int i = 0; i < Words; ++i) r.w[i] = w[i] | b.w[i];
+        return r;
+    }
+    constexpr basic_bitboard operator^(const basic_bitboard& b) const noexcept
+    {
+        basic_bitboard r;
+        for(int i = 0; i < Words; ++i) r.w[i] = w[i] ^ b.w[i];
+        return r;
+    }
+    constexpr basic_bitboard operator~() const noexcept
+    {
+        basic_bitboard r;
+        for(int i = 0; i < Words; ++i) r.w[i] = ~w[i];
+        return r;
+    }
+
+    basic_bitboard& operator&=(const basic_bitboard& b) noexcept { for(int i = 0; i < Words; ++i) w[i] &= b.w[i]; return *this; }
+    basic_bitboard& operator|=(const basic_bitboard& b) noexcept { for(int i = 0; i < Words; ++i) w[i] |= b.w[i]; return *this; }
+    basic_bitboard& operator^=(const basic_bitboard& b) noexcept { for(int i = 0; i < Words; ++i) w[i] ^= b.w[i]; return *this; }
+
+    constexpr bool operator==(const basic_bitboard& b) const noexcept
+    {
+        for(int i = 0; i < Words; ++i)
+        {
+            if(w[i] != b.w[i]) return false;
+        }
+        return true;
+    }
+    constexpr bool operator!=(const basic_bitboard& b) const noexcept { return !(*this == b); }
+
+    // shifts (towards higher or lower cell indices)
+    constexpr basic_bitboard operator<<(int n) const noexcept
+    {
+        if(n <= 0) return *this;
+        basic_bitboard r;
+        int q = n >> 6, s = n & 63;
+        for(int i = Words - 1; i >= q; --i)
+        {
+            r.w[i] = w[i - q] << s;
+            if(s && i - q - 1 >= 0) r.w[i] |= w[i - q - 1] >> (64 - s);
+        }
+        return r;
+    }
+    constexpr basic_bitboard operator>>(int n) const noexcept
+    {
+        if(n <= 0) return *this;
+        basic_bitboard r;
+        int q = n >> 6, s = n & 63;
+        for(int i = 0; i + q < Words; ++i)
+        {
+            r.w[i] = w[i + q] >> s;
+            if(s && i + q + 1 < Words) r.w[i] |= w[i + q + 1] << (64 - s);
+        }
+        return r;
+    }
+};
+
+// bitboard for the classic battlefield (up to 128 cells)
+//------------------------------------------------------------------------------
+typedef basic_bitboard<2> bitboard;
+
+#endif /* __BITBOARD_HPP__ */
\ No newline at end of file
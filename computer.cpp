@@ -39,31 +39,79 @@
 //
 //==============================================================================
 
-#include <sstream>
 #include <iostream>
 #include "computer.hpp"
+#include "density.hpp"
 #include "functions.hpp"
-
-//------------------------------------------------------------------------------
-std::string make_position(int row, int col) // 0-index input
-{
-    std::stringstream pos;
-    pos << static_cast<char>(col + 'a') << (row + 1);
-    return pos.str();
-}
+#include "snapshot.hpp"
+#include "probe.hpp"
 
 // User class implementation 
 //******************************************************************************
 // initialization
 //------------------------------------------------------------------------------
-computer::computer() 
-: player("Computer"), _hit_mode(false), _first_row(-1), _first_col(-1), _last_row(-1), _last_col(-1), _dir(dir_left),_dir_changes(0), _miss_counter(0), _hit_counter(0)
+computer::computer(int level) 
+: player("Computer"), _level(level), _hit_mode(false), _first_row(-1), _first_col(-1), _last_row(-1), _last_col(-1), _dir(dir_left),_dir_changes(0), _miss_counter(0), _hit_counter(0)
 {;}
 
+//------------------------------------------------------------------------------
+int computer::ParseLevel(const std::string& name) noexcept
+{
+    for(std::size_t i = 0; i < ai_name.size(); ++i)
+    {
+        if(ai_name[i] == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// snapshot
+//------------------------------------------------------------------------------
+void computer::GetState(computer_state& state) const noexcept
+{
+    state.level        = _level;
+    state.hit_mode     = _hit_mode;
+    state.first_row    = _first_row;
+    state.first_col    = _first_col;
+    state.last_row     = _last_row;
+    state.last_col     = _last_col;
+    state.dir          = _dir;
+    state.dir_changes  = _dir_changes;
+    state.miss_counter = _miss_counter;
+    state.hit_counter  = _hit_counter;
+}
+
+//------------------------------------------------------------------------------
+void computer::SetState(const computer_state& state) noexcept
+{
+    _level        = state.level;
+    _hit_mode     = state.hit_mode != 0;
+    _first_row    = state.first_row;
+    _first_col    = state.first_col;
+    _last_row     = state.last_row;
+    _last_col     = state.last_col;
+    _dir          = state.dir;
+    _dir_changes  = state.dir_changes;
+    _miss_counter = state.miss_counter;
+    _hit_counter  = state.hit_counter;
+}
+
 // game play
 //------------------------------------------------------------------------------
 std::string computer::Fire() noexcept
 {
+    int cell = FireCell();
+    return (cell < 0) ? std::string() : cell_position(cell);
+}
+
+//------------------------------------------------------------------------------
+int computer::FireCell() noexcept
+{
+    // select the targeting engine
+    switch(_level)
+    {
+        case ai_density:    return _DensityFire();
+        case ai_montecarlo: return _MonteCarloFire();
+    }
     // check if the hit mode was active
     if(_hit_mode) 
     {
@@ -74,12 +122,13 @@ std::string computer::Fire() noexcept
 }
 
 //------------------------------------------------------------------------------
-void computer::SetTargetGrid(std::string& pos, const char mark)
+void computer::SetTargetGrid(int cell, const char mark) noexcept
 {
     char empty = shot_mark[empty_idx];
-    // parse the input
-    grid_point gp = _ParsePosition(pos);
-    
+    // non-valid cells are ignored
+    if(cell < 0 || cell >= field_cells) return;
+    grid_point gp{ cell / FIELD_COLS, cell % FIELD_COLS };
+
     // check if hit mode is active
     if(_hit_mode)
     {
@@ -111,7 +160,23 @@ void computer::SetTargetGrid(std::string& pos, const char mark)
         if(mark != empty) _SetHitModeON(gp.row, gp.col);
     }
     // run the parent method
-    player::SetTargetGrid(pos, mark);
+    player::SetTargetGrid(cell, mark);
+}
+
+//------------------------------------------------------------------------------
+void computer::SetSunk(int ship, const bitboard& cells) noexcept
+{
+    player::SetSunk(ship, cells);
+    if(!_hit_mode) return;
+    // follow the hits of the ships still afloat, if any
+    bitboard open = _target_hit & ~_target_sunk;
+    if(open.None())
+    {
+        _SetHitModeOFF();
+        return;
+    }
+    int idx = open.Lowest();
+    _SetHitModeON(idx / FIELD_COLS, idx % FIELD_COLS);
 }
 
 // auxiliary methods
@@ -194,8 +259,9 @@ void computer::_SetHitModeOFF() noexcept
 }
 
 //------------------------------------------------------------------------------
-std::string computer::_HitModeFire() noexcept
+int computer::_HitModeFire() noexcept
 {
+    PROBE_SCOPE(probe_hit_mode_fire);
     int row, col;
     // define empty cell
     char empty = shot_mark[empty_idx];
@@ -203,6 +269,7 @@ std::string computer::_HitModeFire() noexcept
     // make an infinite loop until a valid position was found
     while(1)
     {
+        PROBE_EVENT(probe_hit_mode_fire);
         switch(_dir)
         {
             case dir_left:
@@ -229,9 +296,9 @@ std::string computer::_HitModeFire() noexcept
         if(_IsValidPosition(row, col)) 
         {
             // check if the position was previously set
-            if(_target_grid[row][col] == empty) 
+            if(GetTargetGrid(row, col) == empty) 
                 break;
-            else if(_target_grid[row][col] == hit)
+            else if(GetTargetGrid(row, col) == hit)
             {
                 _hit_counter++;
                 _last_col = col;
@@ -268,33 +335,50 @@ std::string computer::_HitModeFire() noexcept
         }
     }
     // return the position
-    return make_position(row, col);
+    return cell_index(row, col);
 }
 
 
 //------------------------------------------------------------------------------
-std::string computer::_RandomFire() noexcept
+int computer::_RandomFire() noexcept
 {
-    // define empty cell
-    char empty = shot_mark[empty_idx];
-    // set the range
-    double max_rows = FIELD_ROWS - 1.;
-    double max_cols = FIELD_COLS - 1.;
-    int row, col;
-    // make an infinite loop until a valid position was found
-    while(1)
+    PROBE_SCOPE(probe_random_fire);
+    // get the cells not fired yet
+    bitboard empty = field_mask & ~(_target_miss | _target_hit);
+    int n = empty.Count();
+    // no cells left: return a non-valid cell
+    if(n == 0) return -1;
+    // extract one of them uniformly
+    return empty.Select(static_cast<int>(_rng.Below(n)));
+}
+
+//------------------------------------------------------------------------------
+int computer::_DensityFire() noexcept
+{
+    // fire at the cell covered by most of the legal placements of the ships
+    // afloat, the sunk ships cells blocked (-1 if no cells are left)
+    int sizes[destroier_idx];
+    int n = _AfloatSizes(sizes);
+    return density_target(_target_miss | _target_sunk, _target_hit & ~_target_sunk, sizes, n, _rng);
+}
+
+//------------------------------------------------------------------------------
+int computer::_MonteCarloFire() noexcept
+{
+    // fire at the cell occupied most often by the fleets sampled within the budget
+    // (-1 if no cells are left)
+    int sizes[destroier_idx];
+    int n = _AfloatSizes(sizes);
+    return montecarlo_target(_target_miss | _target_sunk, _target_hit & ~_target_sunk, sizes, n, _montecarlo, _rng);
+}
+
+//------------------------------------------------------------------------------
+int computer::_AfloatSizes(int* sizes) const noexcept
+{
+    int n = 0;
+    for(int s = carrier_idx; s <= destroier_idx; ++s)
     {
-        // generate the position
-        row = static_cast<int>(max_rows * rand01());
-        col = static_cast<int>(max_cols * rand01());
-        // check if the position is valid
-        if(_IsValidPosition(row, col)) 
-        {
-            // check if the position was previously set
-            if(_target_grid[row][col] == empty) 
-                break;
-        }
+        if(!IsSunk(s)) sizes[n++] = ship_size[s];
     }
-    // return the position
-    return make_position(row, col);
-}
+    return n;
+}
\ No newline at end of file
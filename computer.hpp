@@ -43,6 +43,15 @@
 #define __COMPUTER_HPP__
 
 #include "player.hpp"
+#include "montecarlo.hpp"
+
+struct computer_state;
+
+// targeting levels
+//------------------------------------------------------------------------------
+enum ai_level { ai_classic = 0, ai_density = 1, ai_montecarlo = 2 };
+
+const std::vector<std::string> ai_name = { "classic", "density", "montecarlo" };
 
 // computer class
 //------------------------------------------------------------------------------
@@ -50,13 +59,25 @@ class computer: public player
 {
     public:
         // initialization
-        computer();
+        computer(int level = ai_classic);
+        void inline SetLevel(int level) noexcept { _level = level; }
+        int  inline GetLevel() const    noexcept { return _level; }
+        static int  ParseLevel(const std::string& name) noexcept; // -1 if unknown
+        void inline SetMonteCarlo(const montecarlo_config& config) noexcept { _montecarlo = config; }
+
+        // snapshot (snapshot.hpp), targeting state only
+        void GetState(computer_state& state) const noexcept;
+        void SetState(const computer_state& state) noexcept;
 
         // game play
+        bool inline Place() noexcept { return InitRandom(); }
         std::string Fire() noexcept;
+        int         FireCell() noexcept; // cell index, -1 if no cell is left
 
         // get (0-index rows and cols)
-        void SetTargetGrid(std::string& pos, const char mark);
+        using player::SetTargetGrid;
+        void SetTargetGrid(int cell, const char mark) noexcept override;
+        void SetSunk(int ship, const bitboard& cells) noexcept override;
 
     protected:
         // auxiliary methods
@@ -65,10 +86,15 @@ class computer: public player
         bool        _IsMainDirection(int dir)       noexcept;
         int         _UpdateDirection(int dir)       noexcept;            
         void        _SetHitModeOFF()                noexcept;
-        std::string _HitModeFire()                  noexcept;
-        std::string _RandomFire()                   noexcept;
+        int         _HitModeFire()                  noexcept;
+        int         _RandomFire()                   noexcept;
+        int         _DensityFire()                  noexcept;
+        int         _MonteCarloFire()               noexcept;
+        int         _AfloatSizes(int* sizes) const  noexcept; // sizes of the antagonist ships afloat
 
         // instance variables
+        int  _level;
+        montecarlo_config _montecarlo;
         bool _hit_mode;
         int  _first_row, _first_col;
         int  _last_row,  _last_col;
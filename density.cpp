@@ -0,0 +1,107 @@
+//==============================================================================
+//
+// density.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Probability density targeting implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "density.hpp"
+
+// density functions
+//******************************************************************************
+void compute_density(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                     cell_counter& all, cell_counter& through_hits) noexcept
+{
+    // cells that can host a ship
+    bitboard free = field_mask & ~miss;
+    int k;
+    // scan the ships
+    for(int i = 0; i < n; ++i)
+    {
+        int size = sizes[i];
+        // horizontal placements (anchor = leftmost cell)
+        bitboard anchors = horizontal_anchors(free, size);
+        bitboard covers  = hit;
+        for(k = 1; k < size; ++k) covers |= hit >> k;
+        bitboard hitting = anchors & covers;
+        for(k = 0; k < size; ++k)
+        {
+            all.Add(anchors << k);
+            through_hits.Add(hitting << k);
+        }
+        // vertical placements (anchor = top cell)
+        anchors = vertical_anchors(free, size);
+        covers  = hit;
+        for(k = 1; k < size; ++k) covers |= hit >> (k * FIELD_COLS);
+        hitting = anchors & covers;
+        for(k = 0; k < size; ++k)
+        {
+            all.Add(anchors << (k * FIELD_COLS));
+            through_hits.Add(hitting << (k * FIELD_COLS));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+int density_target(const bitboard& miss, const bitboard& hit, const int* sizes, int n, rng& gen) noexcept
+{
+    // weight of the placements through the hits (above any plain count)
+    const int hit_weight = 64;
+    // make the density maps
+    cell_counter all, through_hits;
+    compute_density(miss, hit, sizes, n, all, through_hits);
+    // scan the cells not fired yet
+    bitboard candidates = field_mask & ~(miss | hit);
+    int best = -1, best_score = -1, ties = 0;
+    while(candidates.Any())
+    {
+        int idx   = candidates.PopLowest();
+        int score = all.Get(idx) + hit_weight * through_hits.Get(idx);
+        if(score > best_score)
+        {
+            best       = idx;
+            best_score = score;
+            ties       = 1;
+        }
+        else if(score == best_score)
+        {
+            // uniform choice among the ties
+            if(gen.Below(++ties) == 0) best = idx;
+        }
+    }
+    return best;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+//==============================================================================
+//
+// density.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Probability density targeting header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __DENSITY_HPP__
+#define __DENSITY_HPP__
+
+#include "placement.hpp"
+
+// cell counter structure
+//------------------------------------------------------------------------------
+//
+// bit-sliced per-cell counters: plane[i] holds bit i of the counter of every
+// cell, so adding a whole placement mask costs a few word operations.
+//
+struct cell_counter
+{
+    static const int planes = 8; // counters up to 255
+
+    bitboard plane[planes];
+
+    void inline Add(const bitboard& mask) noexcept
+    {
+        bitboard carry = mask;
+        for(int i = 0; i < planes && carry.Any(); ++i)
+        {
+            bitboard t = plane[i] & carry;
+            plane[i]  ^= carry;
+            carry      = t;
+        }
+    }
+
+    int inline Get(int idx) const noexcept
+    {
+        int v = 0;
+        for(int i = 0; i < planes; ++i) v |= plane[i].Test(idx) << i;
+        return v;
+    }
+};
+
+// placement functions
+//------------------------------------------------------------------------------
+//
+// anchor cells (leftmost or top cell) of the placements of a ship of the given
+// size lying on 'free' cells only
+//
+bitboard inline horizontal_anchors(const bitboard& free, int size) noexcept
+{
+    bitboard anchors = free & *placement_views[size].horizontal_anchors;
+    for(int k = 1; k < size; ++k) anchors &= free >> k;
+    return anchors;
+}
+
+bitboard inline vertical_anchors(const bitboard& free, int size) noexcept
+{
+    bitboard anchors = free & *placement_views[size].vertical_anchors;
+    for(int k = 1; k < size; ++k) anchors &= free >> (k * FIELD_COLS);
+    return anchors;
+}
+
+// density functions
+//------------------------------------------------------------------------------
+//
+// For every cell count the legal placements of the given ships covering it,
+// given the misses and hits on a target grid. Placements covering at least one
+// hit are counted in 'through_hits' too.
+//
+void compute_density(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                     cell_counter& all, cell_counter& through_hits) noexcept;
+
+// cell not fired yet with the highest density (ties broken at random), -1 if none
+int  density_target(const bitboard& miss, const bitboard& hit, const int* sizes, int n, rng& gen) noexcept;
+
+#endif /* __DENSITY_HPP__ */
\ No newline at end of file
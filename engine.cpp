@@ -0,0 +1,106 @@
+//==============================================================================
+//
+// engine.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Headless battleship game engine implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "engine.hpp"
+#include "snapshot.hpp"
+
+// Engine class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+engine::engine(player& first, player& second)
+: _players{ &first, &second }, _turn(first_side), _winner(no_side), _shots{ 0, 0 }
+{}
+
+//------------------------------------------------------------------------------
+void engine::Reset() noexcept
+{
+    _turn     = first_side;
+    _winner   = no_side;
+    _shots[0] = 0;
+    _shots[1] = 0;
+}
+
+// snapshot
+//------------------------------------------------------------------------------
+void engine::GetState(engine_state& state) const noexcept
+{
+    state.turn     = _turn;
+    state.winner   = _winner;
+    state.shots[0] = _shots[0];
+    state.shots[1] = _shots[1];
+}
+
+//------------------------------------------------------------------------------
+void engine::SetState(const engine_state& state) noexcept
+{
+    _turn     = state.turn;
+    _winner   = state.winner;
+    _shots[0] = state.shots[0];
+    _shots[1] = state.shots[1];
+}
+
+// game play
+//------------------------------------------------------------------------------
+step_result engine::Step(std::string& pos) noexcept
+{
+    return Step(_players[_turn]->Cell(pos));
+}
+
+//------------------------------------------------------------------------------
+step_result engine::Step(int cell) noexcept
+{
+    // the game is over
+    if(End()) return step_result{ _turn, shot_invalid, -1, '\0', false, empty_idx };
+    // play the shot
+    step_result res = play_shot(*_players[_turn], *_players[1 - _turn], _turn, cell);
+    if(res.outcome == shot_invalid) return res;
+    _shots[_turn]++;
+    // check the end of the game
+    if(res.end)
+    {
+        _winner = _turn;
+        return res;
+    }
+    // switch the turn
+    _turn = 1 - _turn;
+    return res;
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+//==============================================================================
+//
+// engine.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Headless battleship game engine header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __ENGINE_HPP__
+#define __ENGINE_HPP__
+
+#include <type_traits>
+#include "player.hpp"
+
+// engine sides
+//------------------------------------------------------------------------------
+enum side_index { first_side = 0, second_side = 1, no_side = -1 };
+
+// shot outcomes
+//------------------------------------------------------------------------------
+enum shot_outcome { shot_invalid = 0, shot_miss = 1, shot_hit = 2 };
+
+// step result structure
+//------------------------------------------------------------------------------
+struct step_result
+{
+    int  shooter; // side that fired the shot
+    int  outcome; // shot_outcome
+    int  cell;    // 0-index cell of the shot, -1 if not valid
+    char mark;    // ocean grid mark returned by the antagonist
+    bool end;     // true if the shot won the game
+    int  sunk;    // ship_index sunk by the shot, empty_idx otherwise
+};
+
+// shot functions
+//------------------------------------------------------------------------------
+//
+// One shot of 'shooter' (playing 'side') on 'antagonist': the antagonist ocean
+// grid is checked and the outcome is notified to the shooter. For a concrete
+// strategy type (strategy.hpp) the notifications are static calls, for player
+// (engine class) they are virtual calls.
+//
+template<class Shooter>
+void inline notify_target(Shooter& shooter, int cell, char mark) noexcept
+{
+    if constexpr(std::is_same<Shooter, player>::value) shooter.SetTargetGrid(cell, mark);
+    else                                               shooter.Shooter::SetTargetGrid(cell, mark);
+}
+
+template<class Shooter>
+void inline notify_sunk(Shooter& shooter, int ship, const bitboard& cells) noexcept
+{
+    if constexpr(std::is_same<Shooter, player>::value) shooter.SetSunk(ship, cells);
+    else                                               shooter.Shooter::SetSunk(ship, cells);
+}
+
+template<class Shooter, class Antagonist>
+step_result play_shot(Shooter& shooter, Antagonist& antagonist, int side, int cell) noexcept
+{
+    step_result res{ side, shot_invalid, -1, '\0', false, empty_idx };
+    // check the shot on the antagonist ocean grid
+    shot_report rep = antagonist.CheckShot(cell);
+    // a non-valid cell does not consume the turn
+    if(rep.result == 0) return res;
+    // update the shooter target grid
+    res.mark    = rep.Mark();
+    notify_target(shooter, cell, res.mark);
+    res.outcome = (rep.result == miss_idx) ? shot_miss : shot_hit;
+    res.cell    = cell;
+    // a sunk ship is revealed to the shooter
+    if(rep.result == sunk_idx)
+    {
+        res.sunk = rep.ship;
+        notify_sunk(shooter, rep.ship, antagonist.GetShipCells(rep.ship));
+    }
+    // check the end of the game
+    res.end = shooter.End();
+    return res;
+}
+
+struct engine_state;
+
+// engine class
+//------------------------------------------------------------------------------
+//
+// Headless game rules: the engine keeps the turn order, forwards each shot to
+// the antagonist (CheckShot) and back to the shooter (SetTargetGrid) and checks
+// the end of the game. No terminal I/O is performed: the shots are provided by
+// the caller, one Step() at a time.
+//
+class engine
+{
+    public:
+        // initialization
+        engine(player& first, player& second);
+        void Reset() noexcept;
+
+        // snapshot (snapshot.hpp)
+        void GetState(engine_state& state) const noexcept;
+        void SetState(const engine_state& state) noexcept;
+
+        // game play
+        step_result Step(std::string& pos) noexcept; // user input boundary
+        step_result Step(int cell) noexcept;         // 0-index cell
+
+        // get
+        int     inline Turn()    const noexcept { return _turn; }
+        int     inline Winner()  const noexcept { return _winner; }
+        bool    inline End()     const noexcept { return _winner != no_side; }
+        int     inline GetShots(int side) const noexcept { return _shots[side]; }
+        player&        Player(int side)  noexcept { return *_players[side]; }
+
+    private:
+        // instance variables
+        player* _players[2];
+        int     _turn;
+        int     _winner;
+        int     _shots[2];
+};
+
+// basic engine class
+//------------------------------------------------------------------------------
+//
+// Headless game rules for any basic_player instantiation (board.hpp): the same
+// turn order as the engine class, with shots given as 0-index cell indices.
+// A board provides Cells(), Shoot(cell), Mark(cell, hit) and End().
+//
+template<class Board>
+class basic_engine
+{
+    public:
+        // initialization
+        basic_engine(Board& first, Board& second) noexcept
+        : _players{ &first, &second }, _turn(first_side), _winner(no_side), _shots{ 0, 0 }
+        {}
+
+        void Reset() noexcept
+        {
+            _turn     = first_side;
+            _winner   = no_side;
+            _shots[0] = 0;
+            _shots[1] = 0;
+        }
+
+        // game play
+        step_result Step(std::int64_t cell) noexcept
+        {
+            step_result res{ _turn, shot_invalid, -1, '\0', false, empty_idx };
+            // the game is over
+            if(End()) return res;
+            // a cell outside the board, before any narrowing to the board cell type
+            if(cell < 0 || cell >= _players[1 - _turn]->Cells()) return res;
+            // check the shot on the antagonist ocean grid
+            int shot = _players[1 - _turn]->Shoot(cell);
+            // a non-valid cell does not consume the turn
+            if(shot < 0) return res;
+            // update the shooter target grid
+            _players[_turn]->Mark(cell, shot == hit_idx);
+            res.outcome = (shot == hit_idx) ? shot_hit : shot_miss;
+            res.cell    = static_cast<int>(cell);
+            res.mark    = shot_mark[shot];
+            _shots[_turn]++;
+            // check the end of the game
+            if(_players[_turn]->End())
+            {
+                _winner = _turn;
+                res.end = true;
+                return res;
+            }
+            // switch the turn
+            _turn = 1 - _turn;
+            return res;
+        }
+
+        // get
+        int     inline Turn()    const noexcept { return _turn; }
+        int     inline Winner()  const noexcept { return _winner; }
+        bool    inline End()     const noexcept { return _winner != no_side; }
+        int     inline GetShots(int side) const noexcept { return _shots[side]; }
+        Board&         Player(int side)  noexcept { return *_players[side]; }
+
+    private:
+        // instance variables
+        Board*  _players[2];
+        int     _turn;
+        int     _winner;
+        int     _shots[2];
+};
+
+#endif /* __ENGINE_HPP__ */
\ No newline at end of file
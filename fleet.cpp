@@ -0,0 +1,100 @@
+//==============================================================================
+//
+// fleet.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Compact fleets and uniform fleet generator implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "fleet.hpp"
+#include "thread_pool.hpp"
+
+// fleet constants
+//******************************************************************************
+const std::size_t bulk_chunk = 1 << 16; // fleets per parallel task
+
+// fleet functions
+//******************************************************************************
+bitboard fleet_cells(const fleet& f) noexcept
+{
+    bitboard cells;
+    for(int s = carrier_idx; s <= fleet_ships; ++s) cells |= fleet_ship(f, s);
+    return cells;
+}
+
+//------------------------------------------------------------------------------
+bool encode_fleet(const bitboard* ship_masks, fleet& f) noexcept
+{
+    for(int s = carrier_idx; s <= fleet_ships; ++s)
+    {
+        int size = ship_size[s];
+        int idx  = ship_masks[s].Lowest();
+        if(idx < 0) return false;
+        // the lowest cell is the anchor: try both orientations
+        int h = placement_index(size, idx / FIELD_COLS, idx % FIELD_COLS, false);
+        int v = placement_index(size, idx / FIELD_COLS, idx % FIELD_COLS, true);
+        if(h >= 0 && placement_views[size].cells[h] == ship_masks[s])
+            f.place[s - 1] = static_cast<std::uint8_t>(h);
+        else if(v >= 0 && placement_views[size].cells[v] == ship_masks[s])
+            f.place[s - 1] = static_cast<std::uint8_t>(v);
+        else
+            return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void random_fleet(rng& gen, fleet& f) noexcept
+{
+    basic_random_fleet(gen, classic_board::placement_type::views, fleet_ships, f.place);
+}
+
+//------------------------------------------------------------------------------
+void generate_fleets(rng& gen, fleet* out, std::size_t n) noexcept
+{
+    for(std::size_t i = 0; i < n; ++i) random_fleet(gen, out[i]);
+}
+
+//------------------------------------------------------------------------------
+void generate_fleets(std::uint64_t seed, fleet* out, std::size_t n, thread_pool& pool)
+{
+    // chunk c is generated on stream c: the output does not depend on the pool size
+    pool.ParallelFor(n, bulk_chunk, [seed, out](std::size_t begin, std::size_t end, int)
+    {
+        rng gen = rng::Stream(seed, begin / bulk_chunk);
+        generate_fleets(gen, out + begin, end - begin);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+//==============================================================================
+//
+// fleet.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Compact fleets and uniform fleet generator header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __FLEET_HPP__
+#define __FLEET_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include "placement.hpp"
+
+class thread_pool;
+
+// fleet constants
+//------------------------------------------------------------------------------
+const int fleet_ships = destroier_idx; // ships 1 .. destroier_idx
+
+// fleet structure
+//------------------------------------------------------------------------------
+//
+// compact fleet: the placement index (placement.hpp) of each ship, one byte
+// per ship. place[s - 1] is the placement of the ship with ship_index s.
+//
+struct fleet
+{
+    std::uint8_t place[fleet_ships];
+};
+
+// fleet functions
+//------------------------------------------------------------------------------
+// cells of ship s (ship_index) of the fleet
+bitboard inline fleet_ship(const fleet& f, int s) noexcept
+{
+    return placement_views[ship_size[s]].cells[f.place[s - 1]];
+}
+
+// cells of the whole fleet
+bitboard fleet_cells(const fleet& f) noexcept;
+
+// compact form of the given ship masks (ship_index), false if a mask is not a placement
+bool encode_fleet(const bitboard* ship_masks, fleet& f) noexcept;
+
+// fleet uniformly distributed over all the non-overlapping fleets (basic_random_fleet)
+void random_fleet(rng& gen, fleet& f) noexcept;
+
+// bulk generation into a caller-provided buffer
+void generate_fleets(rng& gen, fleet* out, std::size_t n) noexcept;
+void generate_fleets(std::uint64_t seed, fleet* out, std::size_t n, thread_pool& pool);
+
+#endif /* __FLEET_HPP__ */
\ No newline at end of file
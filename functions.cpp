@@ -40,31 +40,41 @@
 //==============================================================================
 
 #include "functions.hpp"
+#include "random.hpp"
 #include <iostream>
-#include <random>
 #include <unistd.h>
 
 // input
 //------------------------------------------------------------------------------
 std::string ask(const std::string& message) noexcept
+{
+  return ask(message, std::cin, std::cout);
+}
+
+//------------------------------------------------------------------------------
+std::string ask(const std::string& message, std::istream& in, std::ostream& out) noexcept
 {
   std::string ans;
-  std::cout << '\n';
   // print the message
-  std::cout << "    " << message << ": ";
+  prompt(message, out);
   // wait for the input
-  std::cin >> ans;
+  in >> ans;
   // return ans
   return ans;
 }
 
+//------------------------------------------------------------------------------
+void prompt(const std::string& message, std::ostream& out) noexcept
+{
+  out << '\n';
+  out << "    " << message << ": ";
+  out.flush();
+}
+
 // random generator
 //------------------------------------------------------------------------------
 double rand01()
 {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
-  return dist(gen);
+  return thread_rng().Uniform();
 }
 
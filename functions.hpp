@@ -42,14 +42,17 @@
 #ifndef __FUNCTIONS_HPP__
 #define __FUNCTIONS_HPP__
 
+#include <iosfwd>
 #include <string>
 
 // input
 //------------------------------------------------------------------------------
-std::string ask(const std::string& message) noexcept;
+std::string ask(const std::string& message) noexcept;                                     // std::cin / std::cout
+std::string ask(const std::string& message, std::istream& in, std::ostream& out) noexcept;
+void        prompt(const std::string& message, std::ostream& out) noexcept;               // ask without the wait
 
 // random generator
 //------------------------------------------------------------------------------
-double rand01();
+double rand01(); // uniform in [0, 1), drawn from the per-thread rng (random.hpp)
 
 #endif /* __FUNCTIONS_HPP__ */
\ No newline at end of file
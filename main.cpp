@@ -39,22 +39,75 @@
 //
 //==============================================================================
 
+#include <cstring>
 #include "battleship.hpp"
+#include "session.hpp"
+
+// protocol mode
+//-----------------------------------------------------------------------------
+//
+// the session protocol (session.hpp) on stdin and stdout, without terminal
+// output: the replies are flushed when no more input is buffered, so the
+// commands can be pipelined
+//
+int run_protocol(int strategy)
+{
+    std::ios::sync_with_stdio(false);
+    session     game(thread_rng().Next());
+    std::string line, out;
+    game.SetStrategy(strategy);
+    while(std::getline(std::cin, line))
+    {
+        bool open = game.Handle(line, out);
+        if(!open || out.size() >= 65536 || std::cin.rdbuf()->in_avail() <= 0)
+        {
+            std::cout.write(out.data(), out.size());
+            std::cout.flush();
+            out.clear();
+        }
+        if(!open) break;
+    }
+    std::cout.write(out.data(), out.size());
+    std::cout.flush();
+    return 0;
+}
 
 // main program
 //-----------------------------------------------------------------------------
-int main()
+int main(int argc, char* argv[])
 {
+    // parse the arguments: [-a strategy] [-p] [log]
+    int         strategy = strategy_classic;
+    bool        protocol = false;
+    std::string log_path;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-a") && i + 1 < argc) strategy = parse_strategy(argv[++i]);
+        else if(!std::strcmp(argv[i], "-p"))            protocol = true;
+        else                                            log_path = argv[i];
+    }
+    if(strategy < 0)
+    {
+        std::cerr << "usage: battleship_game [-a strategy] [-p] [log]\n    -p: line protocol on stdin/stdout (session.hpp)\n    strategies:";
+        for(const std::string& name : strategy_name) std::cerr << ' ' << name;
+        std::cerr << std::endl;
+        return 1;
+    }
+    if(protocol) return run_protocol(strategy);
+    // open the optional replay log
+    replay_writer log;
+    if(!log_path.empty() && !log.Open(log_path))
+    {
+        std::cerr << "cannot open the replay log " << log_path << std::endl;
+        return 1;
+    }
     // instanziate a new game
     battleship new_game;
+    new_game.SetOpponent(strategy);
+    if(!log_path.empty()) new_game.SetReplayLog(&log);
     new_game.Welcome();
     new_game.InitBoard();
     new_game.Play();
     // program end
     return 0;
-}
-
- 
-
-
- 
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+//==============================================================================
+//
+// montecarlo.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Monte Carlo posterior sampling targeting implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include "montecarlo.hpp"
+#include "density.hpp"
+#include "thread_pool.hpp"
+
+// montecarlo constants
+//******************************************************************************
+const int max_fleet  = 8;  // ships per sampled fleet
+const int time_check = 64; // samples between two clock reads
+const int hit_bias   = 2;  // log2 of the weight gained per extra hit covered by a placement
+const int max_candidates = 2 * max_fleet * FIELD_COLS;
+const int max_workers    = 16; // sampling shares of a move
+
+// candidate placement structure
+//------------------------------------------------------------------------------
+struct candidate
+{
+    int      ship, anchor, weight;
+    bitboard cells;
+};
+
+// sampling latch structure
+//------------------------------------------------------------------------------
+//
+// end of the pool shares of one move (the pool may run other tasks)
+//
+struct sampling_latch
+{
+    std::mutex              lock;
+    std::condition_variable done;
+    int                     remaining = 0;
+};
+
+typedef std::chrono::steady_clock clock_type;
+
+// sampling functions
+//******************************************************************************
+//
+// anchors of the placements of a ship of the given size covering cell 'h'
+//
+bitboard inline covering_rows(int h, int size) noexcept
+{
+    bitboard bit = bitboard::Bit(h), cover;
+    for(int k = 0; k < size; ++k) cover |= bit >> k;
+    return cover;
+}
+
+bitboard inline covering_cols(int h, int size) noexcept
+{
+    bitboard bit = bitboard::Bit(h), cover;
+    for(int k = 0; k < size; ++k) cover |= bit >> (k * FIELD_COLS);
+    return cover;
+}
+
+//------------------------------------------------------------------------------
+//
+// place one of the candidate placements, chosen uniformly among all of them
+//
+int inline pick_placement(const bitboard* hor, const bitboard* ver, const bool* placed, int n,
+                          rng& gen, int& anchor, bool& vertical) noexcept
+{
+    int i, total = 0;
+    for(i = 0; i < n; ++i)
+    {
+        if(!placed[i]) total += hor[i].Count() + ver[i].Count();
+    }
+    if(total == 0) return -1;
+    int r = static_cast<int>(gen.Below(total));
+    for(i = 0; i < n; ++i)
+    {
+        if(placed[i]) continue;
+        int h = hor[i].Count(), v = ver[i].Count();
+        if(r < h)     { anchor = hor[i].Select(r);     vertical = false; return i; }
+        if(r < h + v) { anchor = ver[i].Select(r - h); vertical = true;  return i; }
+        r -= h + v;
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+//
+// Constructive sampler: the hits are covered first, picking among the
+// placements through a random uncovered hit (biased towards the placements
+// covering more hits), then the remaining ships are placed uniformly on the
+// free cells. Returns false if the sampler got stuck.
+//
+bool sample_fleet(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                  rng& gen, bitboard& fleet) noexcept
+{
+    bool     placed[max_fleet] = { false };
+    bitboard hor[max_fleet], ver[max_fleet];
+    bitboard occupied, uncovered = hit;
+    int      i, anchor = 0;
+    bool     vertical = false;
+    // cover the hits
+    while(uncovered.Any())
+    {
+        int h = uncovered.Select(static_cast<int>(gen.Below(uncovered.Count())));
+        bitboard free = field_mask & ~(miss | occupied);
+        // collect the placements through the hit, weighted by the hits they cover
+        candidate cand[max_candidates];
+        int      nc = 0, total = 0;
+        for(i = 0; i < n; ++i)
+        {
+            if(placed[i]) continue;
+            for(int v = 0; v < 2; ++v)
+            {
+                bitboard anchors = v ? (vertical_anchors(free, sizes[i])   & covering_cols(h, sizes[i]))
+                                     : (horizontal_anchors(free, sizes[i]) & covering_rows(h, sizes[i]));
+                while(anchors.Any() && nc < max_candidates)
+                {
+                    candidate& c = cand[nc++];
+                    c.ship   = i;
+                    c.anchor = anchors.PopLowest();
+                    c.cells  = placement_cells(c.anchor, sizes[i], v != 0);
+                    c.weight = 1 << (hit_bias * ((c.cells & uncovered).Count() - 1));
+                    total   += c.weight;
+                }
+            }
+        }
+        if(total == 0) return false;
+        // extract one placement
+        int r = static_cast<int>(gen.Below(total));
+        int k = 0;
+        while(r >= cand[k].weight) r -= cand[k++].weight;
+        occupied  |= cand[k].cells;
+        uncovered &= ~cand[k].cells;
+        placed[cand[k].ship] = true;
+    }
+    // place the other ships
+    for(int s = 0; s < n; ++s)
+    {
+        if(placed[s]) continue;
+        bitboard free = field_mask & ~(miss | occupied);
+        for(i = 0; i < n; ++i)
+        {
+            hor[i] = (i == s) ? horizontal_anchors(free, sizes[i]) : bitboard();
+            ver[i] = (i == s) ? vertical_anchors(free, sizes[i])   : bitboard();
+        }
+        i = pick_placement(hor, ver, placed, n, gen, anchor, vertical);
+        if(i < 0) return false;
+        occupied |= placement_cells(anchor, sizes[i], vertical);
+        placed[i] = true;
+    }
+    fleet = occupied;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void sample_cells(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                  clock_type::time_point deadline, long cap, rng gen, long* counts, long& accepted) noexcept
+{
+    bitboard shot = miss | hit;
+    bitboard fleet;
+    long     tries = 0;
+    while(true)
+    {
+        // check the deadline and the cap
+        if((tries++ % time_check) == 0 && clock_type::now() >= deadline) break;
+        if(cap > 0 && accepted >= cap) break;
+        // sample a fleet
+        if(!sample_fleet(miss, hit, sizes, n, gen, fleet)) continue;
+        accepted++;
+        // count the occupied cells not fired yet
+        bitboard cells = fleet & ~shot;
+        while(cells.Any()) counts[cells.PopLowest()]++;
+    }
+}
+
+// montecarlo functions
+//******************************************************************************
+int montecarlo_target(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                      const montecarlo_config& config, rng& gen, long* samples) noexcept
+{
+    clock_type::time_point deadline = clock_type::now() + config.budget;
+    bitboard candidates = field_mask & ~(miss | hit);
+    if(candidates.None() || n > max_fleet) return -1;
+    // sample the fleets: one share on the caller, the others on the pool
+    // (not from a worker of the same pool, whose queue would wait for it)
+    thread_pool* pool = (config.pool && !config.pool->InWorker()) ? config.pool : nullptr;
+    int  workers = pool ? std::min(pool->Size(), max_workers) : 1;
+    long cap     = (config.max_samples > 0) ? (config.max_samples + workers - 1) / workers : 0;
+    long counts[max_workers][field_cells] = {};
+    long accepted[max_workers]            = {};
+    sampling_latch latch;
+    for(int w = 1; w < workers; ++w)
+    {
+        rng child = gen.Split();
+        try
+        {
+            {
+                std::lock_guard<std::mutex> guard(latch.lock);
+                latch.remaining++;
+            }
+            pool->Submit([&, w, child](int)
+            {
+                sample_cells(miss, hit, sizes, n, deadline, cap, child, counts[w], accepted[w]);
+                std::lock_guard<std::mutex> guard(latch.lock);
+                if(--latch.remaining == 0) latch.done.notify_one();
+            });
+        }
+        catch(...)
+        {
+            // the share is sampled by the caller
+            {
+                std::lock_guard<std::mutex> guard(latch.lock);
+                latch.remaining--;
+            }
+            sample_cells(miss, hit, sizes, n, deadline, cap, child, counts[w], accepted[w]);
+        }
+    }
+    sample_cells(miss, hit, sizes, n, deadline, cap, gen.Split(), counts[0], accepted[0]);
+    {
+        std::unique_lock<std::mutex> guard(latch.lock);
+        latch.done.wait(guard, [&latch] { return latch.remaining == 0; });
+    }
+    // merge the counters
+    long total = 0;
+    for(int w = 0; w < workers; ++w)
+    {
+        total += accepted[w];
+        if(w == 0) continue;
+        for(int c = 0; c < field_cells; ++c) counts[0][c] += counts[w][c];
+    }
+    if(samples) *samples = total;
+    // no sample in time: fall back to the density map
+    if(total == 0) return density_target(miss, hit, sizes, n, gen);
+    // select the most occupied cell
+    int  best = -1, ties = 0;
+    long best_count = -1;
+    while(candidates.Any())
+    {
+        int idx = candidates.PopLowest();
+        if(counts[0][idx] > best_count)
+        {
+            best       = idx;
+            best_count = counts[0][idx];
+            ties       = 1;
+        }
+        else if(counts[0][idx] == best_count)
+        {
+            if(gen.Below(++ties) == 0) best = idx;
+        }
+    }
+    return best;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+//==============================================================================
+//
+// montecarlo.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Monte Carlo posterior sampling targeting header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __MONTECARLO_HPP__
+#define __MONTECARLO_HPP__
+
+#include <chrono>
+#include "player.hpp"
+
+class thread_pool;
+
+// montecarlo configuration structure
+//------------------------------------------------------------------------------
+//
+// budget      : per-move deadline, sampling stops when it expires
+// max_samples : optional cap on the samples of a move (0 = deadline only)
+// pool        : optional pool to sample in parallel (nullptr = caller thread):
+//               the caller samples one share and waits for the others only.
+//               On a worker of the pool itself the move is sampled serially.
+//
+struct montecarlo_config
+{
+    std::chrono::microseconds budget{ 1000 };
+    long                      max_samples = 0;
+    thread_pool*              pool        = nullptr;
+};
+
+// montecarlo functions
+//------------------------------------------------------------------------------
+//
+// Sample fleets consistent with the misses and hits of a target grid and fire
+// at the cell not fired yet that is occupied in most samples (anytime: the
+// best cell found when the deadline expires is returned). Returns -1 if no
+// cell is left; 'samples' (optional) receives the number of accepted samples.
+//
+int montecarlo_target(const bitboard& miss, const bitboard& hit, const int* sizes, int n,
+                      const montecarlo_config& config, rng& gen, long* samples = nullptr) noexcept;
+
+#endif /* __MONTECARLO_HPP__ */
\ No newline at end of file
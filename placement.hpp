@@ -0,0 +1,100 @@
+//==============================================================================
+//
+// placement.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Compile-time tables of the legal ship placements
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __PLACEMENT_HPP__
+#define __PLACEMENT_HPP__
+
+#include "player.hpp"
+
+// placement constants
+//------------------------------------------------------------------------------
+const int max_ship_size = classic_fleet::max_size; // largest ship_size value
+
+// placement functions
+//------------------------------------------------------------------------------
+//
+// classic battlefield instantiation of the placement numbering (board.hpp)
+//
+constexpr int horizontal_count(int size) { return basic_horizontal_count<FIELD_ROWS, FIELD_COLS>(size); }
+constexpr int vertical_count(int size)   { return basic_vertical_count<FIELD_ROWS, FIELD_COLS>(size); }
+constexpr int placement_count(int size)  { return basic_placement_count<FIELD_ROWS, FIELD_COLS>(size); }
+
+// index of the placement anchored at (row, col), -1 if it leaves the field
+constexpr int placement_index(int size, int row, int col, bool vertical)
+{
+    return basic_placement_index<FIELD_ROWS, FIELD_COLS>(size, row, col, vertical);
+}
+
+// placement tables
+//------------------------------------------------------------------------------
+template<int Size>
+using placement_table = basic_placement_table<FIELD_ROWS, FIELD_COLS, Size>;
+
+template<int Size>
+constexpr const placement_table<Size>& placements = basic_placements<FIELD_ROWS, FIELD_COLS, Size>;
+
+static_assert(placements<max_ship_size>.cells[0] == bitboard::Fill(max_ship_size), "placement table layout");
+
+// placement view structure
+//------------------------------------------------------------------------------
+//
+// run-time access to the table of a ship size (1 .. max_ship_size)
+//
+typedef basic_placement_view<bitboard> placement_view;
+
+constexpr placement_view placement_views[max_ship_size + 1] =
+{
+    placement_view{ nullptr, nullptr, 0, 0, nullptr, nullptr },
+    make_basic_placement_view<FIELD_ROWS, FIELD_COLS, 1>(),
+    make_basic_placement_view<FIELD_ROWS, FIELD_COLS, 2>(),
+    make_basic_placement_view<FIELD_ROWS, FIELD_COLS, 3>(),
+    make_basic_placement_view<FIELD_ROWS, FIELD_COLS, 4>(),
+    make_basic_placement_view<FIELD_ROWS, FIELD_COLS, 5>()
+};
+
+// cells covered by the placement of a ship of the given size at 'anchor'
+bitboard inline placement_cells(int anchor, int size, bool vertical) noexcept
+{
+    int idx = placement_index(size, anchor / FIELD_COLS, anchor % FIELD_COLS, vertical);
+    return placement_views[size].cells[idx];
+}
+
+#endif /* __PLACEMENT_HPP__ */
\ No newline at end of file
@@ -40,60 +40,27 @@
 //==============================================================================
 
 #include "player.hpp"
+#include "placement.hpp"
+#include "fleet.hpp"
+#include "snapshot.hpp"
+#include "probe.hpp"
 #include "functions.hpp"
+#include <algorithm>
 #include <cctype>
+#include <iterator>
 #include <stdexcept>
 #include <iostream>
 #include <numeric>
 
-//------------------------------------------------------------------------------
-grid_point inline shift_position(grid_point pos, int row, int col)
-{
-    return grid_point{ pos.row + row, pos.col + col};
-}
-
-// grid functions
+// cell functions
 //******************************************************************************
-void inline reset_grid(char (*board)[FIELD_COLS])
+std::string cell_position(int cell)
 {
-    for(int r = 0; r < FIELD_ROWS; ++r)
-    {
-        for(int c = 0; c < FIELD_COLS; ++c)
-        {
-            board[r][c] = ship_mark[empty_idx];
-        }
-    }
-}
-
-//------------------------------------------------------------------------------
-void inline copy_grid(const char source[FIELD_ROWS][FIELD_COLS], char target[FIELD_ROWS][FIELD_COLS])
-{
-    for(int r = 0; r < FIELD_ROWS; ++r)
-    {
-        for(int c = 0; c < FIELD_COLS; ++c)
-        {
-            target[r][c] = source[r][c];
-        }
-    }
-}
-
-//------------------------------------------------------------------------------
-void inline print_grid(const char grid[FIELD_ROWS][FIELD_COLS])
-{
-    std::cout << '\n';
-    for(int r = 0; r < FIELD_ROWS; ++r)
-    {
-        std::cout << "    ";
-        for(int c = 0; c < FIELD_COLS; ++c)
-        {
-            if(grid[r][c] == 0)
-                std::cout << '.';
-            else
-                std::cout << grid[r][c];
-        }
-        std::cout << '\n';
-    }
-    std::cout << std::endl;
+    int row = cell / FIELD_COLS, col = cell % FIELD_COLS;
+    std::string pos(1, static_cast<char>(col + 'a'));
+    if(row + 1 >= 10) pos += static_cast<char>('0' + (row + 1) / 10);
+    pos += static_cast<char>('0' + (row + 1) % 10);
+    return pos;
 }
 
 // Player class inplementation 
@@ -117,158 +84,140 @@ bool player::IsInitialized() const
 //------------------------------------------------------------------------------
 bool player::InitRandom() noexcept
 {
-    int  s, N = ship_mark.size();
-    std::string pos(3, ' ');
-    int  dir;
-    bool posed = false;
+    // draw a uniform fleet
+    fleet f;
+    random_fleet(_rng, f);
+    return InitFleet(f);
+}
+
+//------------------------------------------------------------------------------
+bool player::InitFleet(const fleet& f) noexcept
+{
     // reset grids
     Reset();
-    // scan ships
-    for(s = 1; s < N; ++s)
-    {
-        while(true)
-        {
-            // extract two coordinates
-            pos[0] = static_cast<char>((FIELD_COLS - 1.) * rand01()) + 'a';
-            pos[1] = static_cast<char>((FIELD_ROWS - 1.) * rand01()) + '1';
-            // extrack direction
-            dir = (direction)(3. * rand01() + 1.);
-            // add a ship
-            posed = InitShip(s, pos, dir);
-            if(posed) break;
-        }
-    }
+    // place the ships
+    for(int s = carrier_idx; s <= fleet_ships; ++s) _PlaceShip(s, fleet_ship(f, s));
     return true;
 }
 
+//------------------------------------------------------------------------------
+bool player::GetFleet(fleet& f) const noexcept
+{
+    return encode_fleet(_ship_mask, f);
+}
+
 //------------------------------------------------------------------------------
 bool player::InitShip(int idx, std::string& pos, int dir) noexcept
 {
-    // back up board
-    char backup[FIELD_ROWS][FIELD_COLS];
-    copy_grid(_ocean_grid, backup);
-    // get ship symbol and size
-    char empty = ship_mark[empty_idx];
-    char mark = ship_mark[idx];
+    return InitShip(idx, Cell(pos), dir);
+}
+
+//------------------------------------------------------------------------------
+bool player::InitShip(int idx, int cell, int dir) noexcept
+{
+    PROBE_SCOPE(probe_init_ship);
+    // get ship size
     int  size = ship_size[idx];
-    int  i, j;
-    // parse position
-    grid_point rc0 = _ParsePosition(pos);
-    grid_point rc1{ 0, 0 };
-    // switch direction
+    int  place;
+    // check the anchor cell
+    if(cell < 0 || cell >= field_cells)
+    {
+        PROBE_EVENT(probe_init_ship);
+        return false;
+    }
+    int row = cell / FIELD_COLS, col = cell % FIELD_COLS;
+    // get the placement anchored at the top left ship element
     switch(dir)
     {
-        case dir_right:
-            for(j = 0; j < size; ++j)
-            {
-                // set row and col of chip element
-                rc1 = shift_position(rc0, 0, j);
-                if(!_IsValidPosition(rc1))
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                if(_ocean_grid[rc1.row][rc1.col] != empty)
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                // assign the ship element
-                _ocean_grid[rc1.row][rc1.col] = mark;    
-            }
-            break;
-        case dir_left:
-            for(j = 0; j < size; ++j)
-            {
-                // set row and col of chip element
-                rc1 = shift_position(rc0, 0, -j);
-                if(!_IsValidPosition(rc1))
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                if(_ocean_grid[rc1.row][rc1.col] != empty)
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                // assign the ship element
-                _ocean_grid[rc1.row][rc1.col] = mark;    
-            }
-            break;
-        case dir_up:
-            for(i = 0; i < size; ++i)
-            {
-                // set row and col of chip element
-                rc1 = shift_position(rc0, -i, 0);
-                if(!_IsValidPosition(rc1))
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                if(_ocean_grid[rc1.row][rc1.col] != empty)
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                // assign the ship element
-                _ocean_grid[rc1.row][rc1.col] = mark;    
-            }
-            break;
-        case dir_down:
-            for(i = 0; i < size; ++i)
-            {
-                // set row and col of chip element
-                rc1 = shift_position(rc0, i, 0);
-                if(!_IsValidPosition(rc1))
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                if(_ocean_grid[rc1.row][rc1.col] != empty)
-                {
-                    // restore backup   
-                    copy_grid(backup, _ocean_grid);
-                    // return a non initialized status
-                    return false;
-                }
-                // assign the ship element
-                _ocean_grid[rc1.row][rc1.col] = mark;    
-            }
-            break;
+        case dir_right: place = placement_index(size, row,            col,            false); break;
+        case dir_left:  place = placement_index(size, row,            col - size + 1, false); break;
+        case dir_down:  place = placement_index(size, row,            col,            true);  break;
+        case dir_up:    place = placement_index(size, row - size + 1, col,            true);  break;
+        default:        place = -1;
+    }
+    // return a non initialized status
+    if(place < 0)
+    {
+        PROBE_EVENT(probe_init_ship);
+        return false;
+    }
+    // check collisions with the other ships
+    const bitboard& mask = placement_views[size].cells[place];
+    if((mask & _fleet_mask).Any())
+    {
+        PROBE_EVENT(probe_init_ship);
+        return false;
     }
+    // assign the ship elements
+    _PlaceShip(idx, mask);
     return true;
 }
 
 //------------------------------------------------------------------------------
 void player::Reset() noexcept
 {
-    // reset the grid
-    reset_grid(_ocean_grid);
-    reset_grid(_target_grid);
+    // reset the grids
+    classic_board::Reset();
+    // reset the ships
+    std::fill(std::begin(_health), std::end(_health), 0);
+    std::fill(std::begin(_ship_at), std::end(_ship_at), empty_idx);
+    _target_sunk       = bitboard();
+    _target_sunk_ships = 0;
     // reset initialization
     _initialization = false;
+    _hit_counter    = 0;
+}
+
+// snapshot
+//------------------------------------------------------------------------------
+void player::GetState(player_state& state) const noexcept
+{
+    for(int s = empty_idx; s <= destroier_idx; ++s) state.ship_mask[s] = _ship_mask[s];
+    state.fleet_mask     = _fleet_mask;
+    state.ocean_hit      = _ocean_hit;
+    state.target_miss    = _target_miss;
+    state.target_hit     = _target_hit;
+    state.target_sunk    = _target_sunk;
+    _rng.GetState(state.rng);
+    state.hit_counter    = _hit_counter;
+    state.initialization = _initialization;
+    state.sunk_ships     = _target_sunk_ships;
+    state.reserved       = 0;
+}
+
+//------------------------------------------------------------------------------
+void player::SetState(const player_state& state) noexcept
+{
+    for(int s = empty_idx; s <= destroier_idx; ++s) _ship_mask[s] = state.ship_mask[s];
+    _fleet_mask     = state.fleet_mask;
+    _ocean_hit      = state.ocean_hit;
+    _target_miss    = state.target_miss;
+    _target_hit     = state.target_hit;
+    _target_sunk    = state.target_sunk;
+    _rng.SetState(state.rng);
+    _hit_counter    = state.hit_counter;
+    _initialization = state.initialization != 0;
+    _target_sunk_ships = state.sunk_ships;
+    _RebuildShips();
 }
 
 // get
 //------------------------------------------------------------------------------
 char player::GetOceanGrid(int row, int col)
 {
-    return _ocean_grid[row][col];
+    int idx = cell_index(row, col);
+    // hit cells
+    if(_ocean_hit.Test(idx)) return shot_mark[(_health[_ship_at[idx]] == 0) ? sunk_idx : hit_idx];
+    // ship cells
+    if(_fleet_mask.Test(idx))
+    {
+        for(int s = carrier_idx; s <= destroier_idx; ++s)
+        {
+            if(_ship_mask[s].Test(idx)) return ship_mark[s];
+        }
+    }
+    // empty cells
+    return ship_mark[empty_idx];
 }
 
 //------------------------------------------------------------------------------
@@ -287,7 +236,11 @@ char player::GetOceanGrid(grid_point pos)
 //------------------------------------------------------------------------------
 char player::GetTargetGrid(int row, int col)
 {
-    return _target_grid[row][col];
+    int idx = cell_index(row, col);
+    if(_target_sunk.Test(idx)) return shot_mark[sunk_idx];
+    if(_target_hit.Test(idx))  return shot_mark[hit_idx];
+    if(_target_miss.Test(idx)) return shot_mark[miss_idx];
+    return shot_mark[empty_idx];
 }
 
 //------------------------------------------------------------------------------
@@ -304,81 +257,43 @@ char player::GetTargetGrid(grid_point pos)
 }
 
 //------------------------------------------------------------------------------
-void player::SetTargetGrid(std::string& pos, const char mark)
+int player::Cell(std::string& pos)
 {
-    // parse the position
     grid_point pt = _ParsePosition(pos);
-    // check the position
-    if(_IsValidPosition(pt))
-    {
-        if(mark == shot_mark[empty_idx]) 
-        {   
-            // set miss
-            _target_grid[pt.row][pt.col] = shot_mark[miss_idx];
-        }
-        else
-        {
-            // set hit
-            _target_grid[pt.row][pt.col] = shot_mark[hit_idx];
-            // update the hit_counter
-            _hit_counter++;
-        }
-    }
+    return _IsValidPosition(pt) ? cell_index(pt.row, pt.col) : -1;
 }
 
-// counters
 //------------------------------------------------------------------------------
-int player::CountTargetEmpty() noexcept
+void player::SetTargetGrid(std::string& pos, const char mark)
 {
-    char empty = shot_mark[empty_idx];
-    int counter = 0;
-    int i, j;
-    // scan the target grid
-    for(i = 0; i < FIELD_ROWS; ++i)
-    {
-        for(j = 0; j < FIELD_COLS; ++j)
-        {
-            if(_target_grid[i][j] == empty) counter++;            
-        }
-    }
-    // return the result
-    return counter;
+    SetTargetGrid(Cell(pos), mark);
 }
 
 //------------------------------------------------------------------------------
-int player::CountTargetMiss() noexcept
+void player::SetTargetGrid(int cell, const char mark) noexcept
 {
-    char miss = shot_mark[miss_idx];
-    int counter = 0;
-    int i, j;
-    // scan the target grid
-    for(i = 0; i < FIELD_ROWS; ++i)
+    PROBE_SCOPE(probe_set_target_grid);
+    // check the position
+    if(cell < 0 || cell >= field_cells) return;
+    if(mark == shot_mark[empty_idx])
     {
-        for(j = 0; j < FIELD_COLS; ++j)
-        {
-            if(_target_grid[i][j] == miss) counter++;            
-        }
+        // set miss
+        _target_miss.Set(cell);
+    }
+    else if(!_target_hit.Test(cell))
+    {
+        // set hit
+        _target_hit.Set(cell);
+        // update the hit_counter
+        _hit_counter++;
     }
-    // return the result
-    return counter;
 }
 
 //------------------------------------------------------------------------------
-int player::CountTargetHit() noexcept
+void player::SetSunk(int ship, const bitboard& cells) noexcept
 {
-    char hit = shot_mark[hit_idx];
-    int counter = 0;
-    int i, j;
-    // scan the target grid
-    for(i = 0; i < FIELD_ROWS; ++i)
-    {
-        for(j = 0; j < FIELD_COLS; ++j)
-        {
-            if(_target_grid[i][j] == hit) counter++;            
-        }
-    }
-    // return the result
-    return counter;
+    _target_sunk       |= cells;
+    _target_sunk_ships |= 1 << ship;
 }
 
 // game play
@@ -391,36 +306,33 @@ std::string player::Fire() noexcept
 //------------------------------------------------------------------------------
 char player::CheckShot(std::string& pos) noexcept
 {
-    // get row and col
-    grid_point pt = _ParsePosition(pos);
-    // if is valid...
-    if(_IsValidPosition(pt))
+    return CheckShot(Cell(pos)).Mark();
+}
+
+//------------------------------------------------------------------------------
+shot_report player::CheckShot(int cell) noexcept
+{
+    PROBE_SCOPE(probe_check_shot);
+    // return a non-valid value
+    if(cell < 0 || cell >= field_cells) return shot_report{ 0, empty_idx };
+    // water
+    int s = _ship_at[cell];
+    if(s == empty_idx) return shot_report{ miss_idx, empty_idx };
+    // a new hit damages the ship (a repeated one reports its state only)
+    if(!_ocean_hit.Test(cell))
     {
-        char empty = ship_mark[empty_idx];
-        // check the cell
-        char mark = _ocean_grid[pt.row][pt.col];
-        // update the maker in the ocean grid
-        if(mark != empty)
-        {
-            _ocean_grid[pt.row][pt.col] = shot_mark[hit_idx];
-        }
-        // return the mark
-        return mark; 
+        _ocean_hit.Set(cell);
+        _health[s]--;
     }
-    // return a non-valid value
-    return '\0';
+    return shot_report{ (_health[s] == 0) ? sunk_idx : hit_idx, s };
 }
 
 // game end
 //------------------------------------------------------------------------------
 bool player::End()
 {
-  // get the total number of hits
-  int tot_hits = std::accumulate(std::begin(ship_size), std::end(ship_size), 0);
-  // check the hit counter
-  if(_hit_counter < tot_hits) return false;
-  // if the counter is greater than tot, return true
-  return true;
+  // all the cells of the antagonist fleet were hit
+  return _hit_counter >= classic_fleet::cells;
 }
 
 // auxiliary methods
@@ -441,6 +353,28 @@ grid_point player::_ParsePosition(std::string& pos) // 0-index output
     return grid_point{ -1, -1 };
 }
 
+//------------------------------------------------------------------------------
+void player::_PlaceShip(int ship, const bitboard& mask) noexcept
+{
+    _ship_mask[ship] |= mask;
+    _fleet_mask      |= mask;
+    _health[ship]    += mask.Count();
+    bitboard cells = mask;
+    for(int c; (c = cells.PopLowest()) >= 0; ) _ship_at[c] = static_cast<std::uint8_t>(ship);
+}
+
+//------------------------------------------------------------------------------
+void player::_RebuildShips() noexcept
+{
+    std::fill(std::begin(_ship_at), std::end(_ship_at), empty_idx);
+    for(int s = carrier_idx; s <= destroier_idx; ++s)
+    {
+        _health[s] = (_ship_mask[s] & ~_ocean_hit).Count();
+        bitboard cells = _ship_mask[s] & field_mask;
+        for(int c; (c = cells.PopLowest()) >= 0; ) _ship_at[c] = static_cast<std::uint8_t>(s);
+    }
+}
+
 //------------------------------------------------------------------------------
 bool player::_IsValidPosition(int row, int col) // 0-index check
 {
@@ -43,13 +43,23 @@
 #define __PLAYER_HPP__
 
 #include <string>
+#include <type_traits>
 #include <vector>
+#include "board.hpp"
 
 // battlefield size
 //------------------------------------------------------------------------------
 #define FIELD_ROWS 10
 #define FIELD_COLS 10
 
+// classic battlefield and fleet (fast path of the board templates)
+typedef basic_player<FIELD_ROWS, FIELD_COLS, classic_fleet> classic_board;
+
+const int      field_cells = classic_board::cells;
+const bitboard field_mask  = classic_board::field;
+
+static_assert(std::is_same<classic_board::board_type, bitboard>::value, "classic board type");
+
 // directions
 //------------------------------------------------------------------------------
 enum direction { dir_left = 1, dir_right = 2, dir_up = 3, dir_down = 4 };
@@ -57,7 +67,8 @@ enum direction { dir_left = 1, dir_right = 2, dir_up = 3, dir_down = 4 };
 // ship indices
 //------------------------------------------------------------------------------
 enum ship_index { empty_idx = 0, carrier_idx = 1, battleship_idx = 2, cruiser_idx = 3, submarine_idx = 4, destroier_idx = 5 };
-enum shot_index {                miss_idx    = 1, hit_idx        = 2, sunk_idx    = 3 };
+
+static_assert(classic_fleet::ships == destroier_idx, "classic fleet composition");
 
 // ship features
 //******************************************************************************
@@ -66,6 +77,17 @@ const std::string              ship_mark   = " cbrsd"; // ' ' = empty; 'c' = car
 const std::vector<int>         ship_size   = { 0, 5, 4, 3, 3, 2 };
 const char                     shot_mark[] = " .xX";     // ' ' = empty; '.' = miss; 'x' = hit; 'X' = sunk;
 
+// shot report structure
+//------------------------------------------------------------------------------
+struct shot_report
+{
+    int result; // shot_index (miss_idx, hit_idx, sunk_idx), 0 if not valid
+    int ship;   // ship_index of the ship hit, empty_idx on a miss
+
+    // ocean grid mark of the shot ('\0' if not valid)
+    char inline Mark() const noexcept { return result ? ship_mark[ship] : '\0'; }
+};
+
 // grid point structure
 //------------------------------------------------------------------------------
 //
@@ -78,9 +100,23 @@ const char                     shot_mark[] = " .xX";     // ' ' = empty; '.' = m
 //
 struct grid_point { int row, col; };
 
+// cell index (0-index, row major)
+//------------------------------------------------------------------------------
+int inline cell_index(int row, int col) { return row * FIELD_COLS + col; }
+
+// position of a cell (es: "c5"), for the user interface and the logs
+std::string cell_position(int cell);
+
+struct fleet;
+struct player_state;
+
 // player class (abstract)
 //------------------------------------------------------------------------------
-class player
+//
+// classic game player: the string based API on top of the 10x10 board with
+// the classic fleet (ship_index order)
+//
+class player : public classic_board
 {
     protected:
         // initialization
@@ -92,13 +128,20 @@ class player
 
         // board initialization
         bool        InitRandom() noexcept;
+        bool        InitFleet(const fleet& f) noexcept;
+        bool        GetFleet(fleet& f) const noexcept;
         bool        InitShip      (int idx, std::string& pos  , int dir) noexcept;
         bool inline InitCarrier   (         std::string& pos , int dir) noexcept { return InitShip(carrier_idx,    pos, dir); }
         bool inline InitBattleship(         std::string& pos , int dir) noexcept { return InitShip(battleship_idx, pos, dir); }
         bool inline InitCruiser   (         std::string& pos , int dir) noexcept { return InitShip(cruiser_idx,    pos, dir); }
         bool inline InitSubmarine (         std::string& pos , int dir) noexcept { return InitShip(submarine_idx,  pos, dir); }
         bool inline InitDestroier (         std::string& pos , int dir) noexcept { return InitShip(destroier_idx,  pos, dir); }
+        bool        InitShip      (int idx, int cell, int dir) noexcept; // anchor cell index
         void        Reset() noexcept;
+
+        // snapshot (snapshot.hpp)
+        void        GetState(player_state& state) const noexcept;
+        void        SetState(const player_state& state) noexcept;
         
         // get (0-index rows and cols)
         char GetOceanGrid(int row, int col);
@@ -109,16 +152,22 @@ class player
         char GetTargetGrid(std::string& pos);
         char GetTargetGrid(grid_point pos);
 
-        void SetTargetGrid(std::string& pos, const char mark);
+        int  Cell(std::string& pos); // 0-index cell of a position, -1 if not valid
 
-        // counters
-        int CountTargetEmpty() noexcept;
-        int CountTargetMiss()  noexcept;
-        int CountTargetHit()   noexcept;
+        void         SetTargetGrid(std::string& pos, const char mark);
+        virtual void SetTargetGrid(int cell, const char mark) noexcept;
 
         // game play
         std::string Fire() noexcept;
         char        CheckShot(std::string&       pos) noexcept;
+        shot_report CheckShot(int cell) noexcept;
+        virtual void SetSunk(int ship, const bitboard& cells) noexcept; // antagonist ship sunk
+
+        // ships
+        const bitboard& GetShipCells(int ship)  const noexcept { return _ship_mask[ship]; }
+        int  inline     GetShipHealth(int ship) const noexcept { return _health[ship]; }
+        bool inline     IsSunk(int ship)        const noexcept { return (_target_sunk_ships >> ship) & 1; } // antagonist ship
+        bitboard inline OpenHits()              const noexcept { return _target_hit & ~_target_sunk; }      // antagonist ships afloat
 
         // game end
         int  inline GetHitCounter() const noexcept { return _hit_counter; }
@@ -130,14 +179,18 @@ class player
         bool       _IsValidPosition(int row, int col); // 0-index check
         bool       _IsValidPosition(grid_point& pos);  // 0-index check
         bool       _IsValidPosition(std::string& pos); // 1-index check
+        void       _PlaceShip(int ship, const bitboard& mask) noexcept;
+        void       _RebuildShips() noexcept;           // health and cell owners from the ship masks
 
         // instance variables
         std::string _name;
         int         _error_condition;
         bool        _initialization;
         int         _hit_counter;
-        char        _target_grid[FIELD_ROWS][FIELD_COLS]; // show the situation of the antagonist 
-        char        _ocean_grid [FIELD_ROWS][FIELD_COLS]; // where player ships are positioned
+        int          _health[destroier_idx + 1]; // ocean grid: cells afloat per ship
+        std::uint8_t _ship_at[field_cells];      // ocean grid: ship_index of each cell
+        bitboard     _target_sunk;               // target grid: cells of the sunk antagonist ships
+        int          _target_sunk_ships;         // target grid: bit s set if the antagonist ship s was sunk
 };
 
 #endif /* __PLAYER_HPP__ */
\ No newline at end of file
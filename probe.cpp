@@ -0,0 +1,120 @@
+//==============================================================================
+//
+// probe.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Compile-time switchable hot path instrumentation implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "probe.hpp"
+
+#ifdef BATTLESHIP_PROBES
+
+#include <mutex>
+
+// probe constants
+//******************************************************************************
+static const char* const probe_name[probe_count] =
+{
+    "player::InitShip",
+    "basic_random_fleet",
+    "computer::_RandomFire",
+    "computer::_HitModeFire",
+    "player::CheckShot",
+    "player::SetTargetGrid"
+};
+
+static const char* const probe_event[probe_count] =
+{
+    "rejections", "restarts", "-", "iterations", "-", "-"
+};
+
+// probe totals
+//******************************************************************************
+namespace
+{
+    std::mutex    probe_mutex;
+    probe_counter probe_total[probe_count];
+
+    // merges the table of the thread that owns it
+    struct probe_flusher
+    {
+        ~probe_flusher()
+        {
+            std::lock_guard<std::mutex> lock(probe_mutex);
+            for(int i = 0; i < probe_count; ++i)
+            {
+                probe_total[i].calls  += probe_local.counter[i].calls;
+                probe_total[i].events += probe_local.counter[i].events;
+                probe_total[i].cycles += probe_local.counter[i].cycles;
+                probe_local.counter[i] = probe_counter{};
+            }
+        }
+    };
+
+    // prints the report at exit (after the main thread table was merged)
+    struct probe_reporter
+    {
+        ~probe_reporter() { probe_dump(stderr); }
+    } reporter;
+}
+
+// probe functions
+//******************************************************************************
+void probe_register() noexcept
+{
+    thread_local probe_flusher flusher;
+    probe_local.registered = true;
+}
+
+//------------------------------------------------------------------------------
+void probe_dump(std::FILE* out) noexcept
+{
+    std::lock_guard<std::mutex> lock(probe_mutex);
+    std::fprintf(out, "\n    %-26s %14s %14s %10s %16s %12s\n", "probe", "calls", "events", "per call", "cycles", "per call");
+    for(int i = 0; i < probe_count; ++i)
+    {
+        const probe_counter& c = probe_total[i];
+        if(c.calls == 0 && c.events == 0) continue;
+        double calls = (c.calls > 0) ? static_cast<double>(c.calls) : 1.0;
+        std::fprintf(out, "    %-26s %14llu %14llu %10.2f %16llu %12.1f   %s\n", probe_name[i],
+                     static_cast<unsigned long long>(c.calls), static_cast<unsigned long long>(c.events), c.events / calls,
+                     static_cast<unsigned long long>(c.cycles), c.cycles / calls, probe_event[i]);
+    }
+    std::fflush(out);
+}
+
+#endif /* BATTLESHIP_PROBES */
\ No newline at end of file
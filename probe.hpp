@@ -0,0 +1,149 @@
+//==============================================================================
+//
+// probe.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Compile-time switchable hot path instrumentation header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __PROBE_HPP__
+#define __PROBE_HPP__
+
+#include <cstdint>
+#include <cstdio>
+
+// probe indices
+//------------------------------------------------------------------------------
+enum probe_index
+{
+    probe_init_ship = 0,      // player::InitShip               (events: rejections)
+    probe_random_fleet,       // basic_random_fleet             (events: restarts)
+    probe_random_fire,        // computer::_RandomFire
+    probe_hit_mode_fire,      // computer::_HitModeFire         (events: loop iterations)
+    probe_check_shot,         // player::CheckShot
+    probe_set_target_grid,    // player::SetTargetGrid
+    probe_count
+};
+
+// instrumentation
+//******************************************************************************
+//
+// Hot path counters and timers, compiled in with BATTLESHIP_PROBES only
+// (cmake -DBATTLESHIP_PROBES=ON). Otherwise the macros below expand to
+// nothing.
+//
+// PROBE_SCOPE(id)  : counts a call and times it up to the end of the scope
+// PROBE_EVENT(id)  : counts an event (rejection, restart, iteration) of id
+//
+// Each thread updates its own table, merged into the totals when the thread
+// exits. The report is printed on stderr at program exit.
+//
+#ifdef BATTLESHIP_PROBES
+
+#include <chrono>
+
+// probe counter structure
+//------------------------------------------------------------------------------
+struct probe_counter
+{
+    std::uint64_t calls;
+    std::uint64_t events;
+    std::uint64_t cycles; // timestamp counter ticks (ns where not available)
+};
+
+// probe table structure (per thread)
+//------------------------------------------------------------------------------
+struct probe_table
+{
+    probe_counter counter[probe_count];
+    bool          registered;
+};
+
+inline thread_local probe_table probe_local{};
+
+// probe functions
+//------------------------------------------------------------------------------
+void probe_register() noexcept;        // merge the thread table at thread exit
+void probe_dump(std::FILE* out) noexcept; // report of the merged tables
+
+std::uint64_t inline probe_clock() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+probe_counter inline& probe_at(int id) noexcept
+{
+    if(!probe_local.registered) probe_register();
+    return probe_local.counter[id];
+}
+
+// probe scope class
+//------------------------------------------------------------------------------
+class probe_scope
+{
+    public:
+        explicit probe_scope(int id) noexcept : _id(id), _start(probe_clock()) {}
+        ~probe_scope()
+        {
+            probe_counter& c = probe_at(_id);
+            c.calls++;
+            c.cycles += probe_clock() - _start;
+        }
+        probe_scope(const probe_scope&) = delete;
+        probe_scope& operator=(const probe_scope&) = delete;
+
+    private:
+        int           _id;
+        std::uint64_t _start;
+};
+
+#define PROBE_JOIN2(a, b) a##b
+#define PROBE_JOIN(a, b)  PROBE_JOIN2(a, b)
+#define PROBE_SCOPE(id)   probe_scope PROBE_JOIN(probe_scope_, __LINE__)(id)
+#define PROBE_EVENT(id)   (probe_at(id).events++)
+
+#else
+
+#define PROBE_SCOPE(id)   ((void)0)
+#define PROBE_EVENT(id)   ((void)0)
+
+#endif /* BATTLESHIP_PROBES */
+
+#endif /* __PROBE_HPP__ */
\ No newline at end of file
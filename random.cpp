@@ -0,0 +1,88 @@
+//==============================================================================
+//
+// random.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Fast seedable random number generators implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "random.hpp"
+#include <random>
+
+// Rng class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+void rng::Seed(std::uint64_t seed) noexcept
+{
+    // expand the seed (the state is never all zero)
+    for(std::uint64_t& s : _s) s = splitmix64(seed);
+}
+
+//------------------------------------------------------------------------------
+rng rng::Stream(std::uint64_t master, std::uint64_t id) noexcept
+{
+    // mix the stream id before combining it with the master seed
+    std::uint64_t x = id;
+    std::uint64_t h = splitmix64(x);
+    x = master ^ h;
+    return rng(splitmix64(x));
+}
+
+// state access
+//------------------------------------------------------------------------------
+void rng::GetState(std::uint64_t state[4]) const noexcept
+{
+    for(int i = 0; i < 4; ++i) state[i] = _s[i];
+}
+
+//------------------------------------------------------------------------------
+void rng::SetState(const std::uint64_t state[4]) noexcept
+{
+    for(int i = 0; i < 4; ++i) _s[i] = state[i];
+}
+
+// per-thread generator
+//------------------------------------------------------------------------------
+rng& thread_rng() noexcept
+{
+    thread_local rng gen([]
+    {
+        std::random_device rd;
+        return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+    }());
+    return gen;
+}
\ No newline at end of file
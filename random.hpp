@@ -0,0 +1,132 @@
+//==============================================================================
+//
+// random.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Fast seedable random number generators header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __RANDOM_HPP__
+#define __RANDOM_HPP__
+
+#include <cstdint>
+
+// splitmix64 step
+//------------------------------------------------------------------------------
+//
+// used to expand a 64-bit seed into the generator state and to derive
+// independent streams
+//
+std::uint64_t inline splitmix64(std::uint64_t& x) noexcept
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// rng class
+//------------------------------------------------------------------------------
+//
+// xoshiro256++ generator (Blackman & Vigna): 32 bytes of state, no system
+// calls, no floating point in the integer paths. Every stream is fully
+// defined by its 64-bit seed, so games can be replayed from the seed.
+//
+class rng
+{
+    public:
+        // initialization
+        explicit rng(std::uint64_t seed = 0) noexcept { Seed(seed); }
+        void Seed(std::uint64_t seed) noexcept;
+
+        // independent stream 'id' derived from a master seed
+        static rng Stream(std::uint64_t master, std::uint64_t id) noexcept;
+        // child generator drawn from this one
+        rng        Split() noexcept { return rng(Next()); }
+
+        // generation
+        std::uint64_t inline Next() noexcept
+        {
+            std::uint64_t res = _rotl(_s[0] + _s[3], 23) + _s[0];
+            std::uint64_t t   = _s[1] << 17;
+            _s[2] ^= _s[0];
+            _s[3] ^= _s[1];
+            _s[1] ^= _s[2];
+            _s[0] ^= _s[3];
+            _s[2] ^= t;
+            _s[3]  = _rotl(_s[3], 45);
+            return res;
+        }
+
+        // unbiased integer in [0, n) (Lemire multiply and reject)
+        std::uint32_t inline Below(std::uint32_t n) noexcept
+        {
+            std::uint64_t m = static_cast<std::uint64_t>(static_cast<std::uint32_t>(Next() >> 32)) * n;
+            std::uint32_t l = static_cast<std::uint32_t>(m);
+            if(l < n)
+            {
+                std::uint32_t t = static_cast<std::uint32_t>(-n) % n;
+                while(l < t)
+                {
+                    m = static_cast<std::uint64_t>(static_cast<std::uint32_t>(Next() >> 32)) * n;
+                    l = static_cast<std::uint32_t>(m);
+                }
+            }
+            return static_cast<std::uint32_t>(m >> 32);
+        }
+
+        // uniform double in [0, 1)
+        double inline Uniform() noexcept { return (Next() >> 11) * 0x1.0p-53; }
+
+        // state access (save/restore)
+        void GetState(std::uint64_t state[4]) const noexcept;
+        void SetState(const std::uint64_t state[4]) noexcept;
+
+    private:
+        static std::uint64_t inline _rotl(std::uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+
+        // instance variables
+        std::uint64_t _s[4];
+};
+
+// per-thread generator
+//------------------------------------------------------------------------------
+//
+// seeded once per thread from std::random_device
+//
+rng& thread_rng() noexcept;
+
+#endif /* __RANDOM_HPP__ */
\ No newline at end of file
@@ -0,0 +1,126 @@
+//==============================================================================
+//
+// renderer.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Incremental terminal renderer implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include "renderer.hpp"
+#include "vt100.hpp"
+
+// renderer constants
+//******************************************************************************
+const int run_gap = 6; // unchanged cells cheaper to rewrite than to skip with goto_xy
+
+// Renderer class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+renderer::renderer(int rows, int cols, std::ostream& out)
+: _terminal(out), _rows(rows), _cols(cols), _previous(rows * cols, ' '), _valid(false)
+{}
+
+// draw
+//------------------------------------------------------------------------------
+void renderer::Draw(const char* frame, int stride)
+{
+    // make the frame
+    _out.str("");
+    if(_valid) _Diff(frame, stride);
+    else       _Repaint(frame, stride);
+    // park the cursor below the frame and clear the old prompts
+    _out << goto_xy(1, _rows + 2) << clear_to_eos;
+    // send the frame with a single write
+    const std::string& buf = _out.str();
+    _terminal.flush();
+    _terminal.write(buf.data(), buf.size());
+    _terminal.flush();
+    // keep the frame
+    for(int r = 0; r < _rows; ++r)
+    {
+        std::copy(frame + r * stride, frame + r * stride + _cols, _previous.begin() + r * _cols);
+    }
+    _valid = true;
+}
+
+// auxiliary methods
+//------------------------------------------------------------------------------
+void renderer::_Repaint(const char* frame, int stride)
+{
+    _out << clear_screen << goto_xy(1, 1);
+    for(int r = 0; r < _rows; ++r)
+    {
+        _out.write(frame + r * stride, _cols);
+        _out << '\n';
+    }
+}
+
+//------------------------------------------------------------------------------
+void renderer::_Diff(const char* frame, int stride)
+{
+    for(int r = 0; r < _rows; ++r)
+    {
+        const char* next = frame + r * stride;
+        const char* prev = _previous.data() + r * _cols;
+        int c = 0;
+        while(c < _cols)
+        {
+            // skip the unchanged cells
+            if(next[c] == prev[c])
+            {
+                ++c;
+                continue;
+            }
+            // extend the run over the changed cells and the short gaps between them
+            int begin = c, end = c + 1, gap = 0;
+            for(c = end; c < _cols && gap < run_gap; ++c)
+            {
+                if(next[c] != prev[c])
+                {
+                    end = c + 1;
+                    gap = 0;
+                }
+                else gap++;
+            }
+            // move to the run and write it
+            _out << goto_xy(begin + 1, r + 1);
+            _out.write(next + begin, end - begin);
+            c = end;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+//==============================================================================
+//
+// renderer.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Incremental terminal renderer header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __RENDERER_HPP__
+#define __RENDERER_HPP__
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// renderer class
+//------------------------------------------------------------------------------
+//
+// Incremental terminal renderer of a rows x cols character frame drawn at the
+// top left corner of the screen. The previous frame is kept: the first Draw()
+// (or the first one after Invalidate()) repaints the whole screen, the next
+// ones only move the cursor to the changed cells. Every frame is sent to the
+// terminal with a single write, and the cursor is left at the beginning of the
+// second line below the frame, with the rest of the screen cleared.
+// A renderer only writes to its own output stream.
+//
+class renderer
+{
+    public:
+        // initialization
+        renderer(int rows, int cols, std::ostream& out);
+
+        // repaint the whole screen at the next Draw() (the screen was cleared
+        // or overwritten by someone else)
+        void inline Invalidate() noexcept { _valid = false; }
+
+        // draw a frame: row r is frame[r * stride .. r * stride + cols)
+        void Draw(const char* frame, int stride);
+
+    private:
+        // auxiliary methods
+        void _Repaint(const char* frame, int stride);
+        void _Diff(const char* frame, int stride);
+
+        // instance variables
+        std::ostream&      _terminal;
+        int                _rows, _cols;
+        std::vector<char>  _previous; // frame on the screen
+        bool               _valid;    // the screen shows _previous
+        std::ostringstream _out;      // frame buffer sent to the terminal
+};
+
+#endif /* __RENDERER_HPP__ */
\ No newline at end of file
@@ -0,0 +1,264 @@
+//==============================================================================
+//
+// replay.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Binary game replay log implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "replay.hpp"
+
+// replay constants
+//******************************************************************************
+const std::size_t flush_bytes = 1 << 20; // writer buffer size
+
+// Replay game structure implementation
+//******************************************************************************
+void replay_game::Start(std::uint64_t game_seed, const player& first, const player& second)
+{
+    seed   = game_seed;
+    winner = no_side;
+    shots.clear();
+    first.GetFleet(fleets[first_side]);
+    second.GetFleet(fleets[second_side]);
+}
+
+//------------------------------------------------------------------------------
+void replay_game::Add(const step_result& res)
+{
+    // non-valid shots are not part of the game
+    if(res.outcome == shot_invalid || shots.size() >= replay_max_shots) return;
+    shots.push_back(static_cast<std::uint8_t>(res.cell | ((res.outcome == shot_hit) ? replay_hit_bit : 0)));
+    if(res.end) winner = res.shooter;
+}
+
+// Replay writer class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+replay_writer::~replay_writer()
+{
+    Close();
+}
+
+//------------------------------------------------------------------------------
+bool replay_writer::Open(const std::string& path)
+{
+    Close();
+    replay_file_header header{ replay_magic, replay_version, 0 };
+    std::vector<std::uint64_t> index;
+    // read the existing log and index
+    std::FILE* log = std::fopen(path.c_str(), "rb");
+    if(log)
+    {
+        bool ok = std::fread(&header, sizeof(header), 1, log) == 1 && header.magic == replay_magic && header.version == replay_version;
+        if(ok)
+        {
+            if(std::FILE* idx = std::fopen((path + ".idx").c_str(), "rb"))
+            {
+                std::uint64_t offset;
+                while(std::fread(&offset, sizeof(offset), 1, idx) == 1) index.push_back(offset);
+                std::fclose(idx);
+            }
+            // drop the entries past the end of the log
+            std::fseek(log, 0, SEEK_END);
+            std::uint64_t file_size = static_cast<std::uint64_t>(std::ftell(log));
+            while(!index.empty() && index.back() + sizeof(replay_record) > file_size) index.pop_back();
+            // count the records after the last indexed one, indexing them
+            if(index.empty()) index.push_back(sizeof(header));
+            _games  = (index.size() - 1) * replay_stride;
+            _offset = index.back();
+            replay_record rec;
+            while(_offset + sizeof(rec) <= file_size && std::fseek(log, static_cast<long>(_offset), SEEK_SET) == 0 &&
+                  std::fread(&rec, sizeof(rec), 1, log) == 1 && _offset + rec.Size() <= file_size)
+            {
+                if(_games % replay_stride == 0 && _games / replay_stride >= index.size()) index.push_back(_offset);
+                _offset += rec.Size();
+                _games++;
+            }
+        }
+        std::fclose(log);
+        if(!ok) return false;
+        // drop a record cut by a crash
+        if(::truncate(path.c_str(), static_cast<off_t>(_offset)) != 0) return false;
+    }
+    else
+    {
+        // new log
+        log = std::fopen(path.c_str(), "wb");
+        if(!log) return false;
+        bool ok = std::fwrite(&header, sizeof(header), 1, log) == 1;
+        std::fclose(log);
+        if(!ok) return false;
+        _offset = sizeof(header);
+        _games  = 0;
+    }
+    // rewrite the index and open both files for appending
+    _index = std::fopen((path + ".idx").c_str(), "wb");
+    if(!_index) return false;
+    if(!index.empty()) std::fwrite(index.data(), sizeof(std::uint64_t), index.size(), _index);
+    _log = std::fopen(path.c_str(), "ab");
+    if(!_log)
+    {
+        std::fclose(_index);
+        _index = nullptr;
+        return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool replay_writer::Close()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    bool ok = _Flush();
+    if(_log)   ok &= std::fclose(_log) == 0;
+    if(_index) ok &= std::fclose(_index) == 0;
+    _log   = nullptr;
+    _index = nullptr;
+    return ok;
+}
+
+// write
+//------------------------------------------------------------------------------
+bool replay_writer::Append(const replay_game& game)
+{
+    // make the record
+    replay_record rec;
+    std::memset(&rec, 0, sizeof(rec));
+    rec.seed       = game.seed;
+    rec.shots      = static_cast<std::uint16_t>(game.shots.size());
+    rec.winner     = (game.winner == no_side) ? replay_no_winner : static_cast<std::uint8_t>(game.winner);
+    rec.fleets[0]  = game.fleets[0];
+    rec.fleets[1]  = game.fleets[1];
+    std::size_t size = rec.Size();
+    // append the record
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_log) return false;
+    if(_games % replay_stride == 0 && std::fwrite(&_offset, sizeof(_offset), 1, _index) != 1) return false;
+    std::size_t at = _buffer.size();
+    _buffer.resize(at + size, 0);
+    std::memcpy(&_buffer[at], &rec, sizeof(rec));
+    std::memcpy(&_buffer[at + sizeof(rec)], game.shots.data(), rec.shots);
+    _offset += size;
+    _games++;
+    return (_buffer.size() < flush_bytes) ? true : _Flush();
+}
+
+// auxiliary methods
+//------------------------------------------------------------------------------
+bool replay_writer::_Flush()
+{
+    if(!_log || _buffer.empty()) return true;
+    bool ok = std::fwrite(_buffer.data(), 1, _buffer.size(), _log) == _buffer.size();
+    _buffer.clear();
+    return ok;
+}
+
+// Replay reader class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+replay_reader::~replay_reader()
+{
+    Close();
+}
+
+//------------------------------------------------------------------------------
+bool replay_reader::Open(const std::string& path)
+{
+    Close();
+    // map the log
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) return false;
+    struct stat st;
+    if(::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(replay_file_header))
+    {
+        ::close(fd);
+        return false;
+    }
+    void* data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(data == MAP_FAILED) return false;
+    ::madvise(data, st.st_size, MADV_SEQUENTIAL);
+    _data   = static_cast<const char*>(data);
+    _size   = st.st_size;
+    _mapped = st.st_size;
+    // check the header
+    const replay_file_header* header = reinterpret_cast<const replay_file_header*>(_data);
+    if(header->magic != replay_magic || header->version != replay_version)
+    {
+        Close();
+        return false;
+    }
+    // read the index, dropping the entries past the end of the log
+    if(std::FILE* idx = std::fopen((path + ".idx").c_str(), "rb"))
+    {
+        std::uint64_t offset;
+        while(std::fread(&offset, sizeof(offset), 1, idx) == 1 && offset + sizeof(replay_record) <= _size)
+        {
+            _blocks.push_back(offset);
+        }
+        std::fclose(idx);
+    }
+    if(_blocks.empty()) _blocks.push_back(sizeof(replay_file_header));
+    // stop at the last complete record, splitting the records past the index
+    // (missing or behind the log) every replay_stride games
+    std::size_t end = _blocks.back(), games = 0;
+    while(end + sizeof(replay_record) <= _size && end + _At(end)->Size() <= _size)
+    {
+        if(games > 0 && games % replay_stride == 0) _blocks.push_back(end);
+        end += _At(end)->Size();
+        games++;
+    }
+    _size = end;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void replay_reader::Close() noexcept
+{
+    if(_data) ::munmap(const_cast<char*>(_data), _mapped);
+    _data   = nullptr;
+    _size   = 0;
+    _mapped = 0;
+    _blocks.clear();
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+//==============================================================================
+//
+// replay.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Binary game replay log header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __REPLAY_HPP__
+#define __REPLAY_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "engine.hpp"
+#include "fleet.hpp"
+
+// replay constants
+//------------------------------------------------------------------------------
+const std::uint32_t replay_magic      = 0x4c525342; // "BSRL"
+const std::uint32_t replay_version    = 1;
+const std::uint8_t  replay_hit_bit    = 0x80;       // shot byte: cell | hit bit
+const std::uint8_t  replay_no_winner  = 0xff;       // aborted game
+const std::size_t   replay_stride     = 4096;       // games per index entry
+const std::size_t   replay_max_shots  = 0xffff;
+
+static_assert(field_cells <= replay_hit_bit, "a shot byte holds the cell index and the hit bit");
+
+// replay file header structure
+//------------------------------------------------------------------------------
+struct replay_file_header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t reserved;
+};
+
+// replay record structure
+//------------------------------------------------------------------------------
+//
+// One game: the fixed 24 byte header below followed by 'shots' bytes (cell
+// index, plus replay_hit_bit on hits). Sides alternate from first_side, as in
+// the engine. Records are padded to 8 bytes so that a mapped log can be read
+// in place.
+//
+// log file   : replay_file_header, record, record, ...
+// index file : (log).idx, the file offset of every replay_stride-th record
+//
+struct replay_record
+{
+    std::uint64_t seed;      // game seed (both players are seeded from it)
+    std::uint16_t shots;     // number of shots
+    std::uint8_t  winner;    // side_index of the winner, replay_no_winner if aborted
+    std::uint8_t  flags;     // reserved
+    fleet         fleets[2]; // compact fleets of first and second side
+    std::uint8_t  pad[2];
+
+    // get
+    const std::uint8_t*  Shots()       const noexcept { return reinterpret_cast<const std::uint8_t*>(this + 1); }
+    int          inline Cell(int k)    const noexcept { return Shots()[k] & ~replay_hit_bit; }
+    bool         inline Hit(int k)     const noexcept { return (Shots()[k] & replay_hit_bit) != 0; }
+    int          inline Shooter(int k) const noexcept { return (k & 1) ? second_side : first_side; }
+
+    // record size, padding included
+    std::size_t  inline Size()         const noexcept { return (sizeof(replay_record) + shots + 7) & ~std::size_t(7); }
+    const replay_record* Next()        const noexcept
+    {
+        return reinterpret_cast<const replay_record*>(reinterpret_cast<const char*>(this) + Size());
+    }
+};
+
+static_assert(sizeof(replay_record) == 24, "replay record layout");
+
+// replay game structure
+//------------------------------------------------------------------------------
+//
+// game being recorded: Start() before the first shot, Add() after each step
+//
+struct replay_game
+{
+    std::uint64_t             seed;
+    fleet                     fleets[2];
+    int                       winner = no_side;
+    std::vector<std::uint8_t> shots;
+
+    void Start(std::uint64_t game_seed, const player& first, const player& second);
+    void Add(const step_result& res);
+};
+
+// replay writer class
+//------------------------------------------------------------------------------
+//
+// Appends records to a log file and its index. Append() may be called from
+// several threads.
+//
+class replay_writer
+{
+    public:
+        // initialization
+        replay_writer() = default;
+        ~replay_writer();
+        bool Open(const std::string& path); // append to an existing log, create it otherwise
+        bool Close();
+
+        // write
+        bool Append(const replay_game& game);
+
+        // get
+        std::uint64_t inline Games() const noexcept { return _games; }
+
+    private:
+        // auxiliary methods
+        bool _Flush();
+
+        // instance variables
+        std::FILE*                _log    = nullptr;
+        std::FILE*                _index  = nullptr;
+        std::uint64_t             _offset = 0;  // file offset of the next record
+        std::uint64_t             _games  = 0;  // records in the log
+        std::vector<std::uint8_t> _buffer;      // records not written yet
+        std::mutex                _mutex;
+};
+
+// replay reader class
+//------------------------------------------------------------------------------
+//
+// Memory-mapped, read-only view of a log. Iterating the records performs no
+// parsing and no allocation. Blocks are the replay_stride record runs of the
+// index, to split a scan among threads.
+//
+class replay_reader
+{
+    public:
+        // iterator
+        class iterator
+        {
+            public:
+                iterator(const replay_record* rec) noexcept : _rec(rec) {}
+                const replay_record& operator*()  const noexcept { return *_rec; }
+                const replay_record* operator->() const noexcept { return _rec; }
+                iterator& operator++() noexcept { _rec = _rec->Next(); return *this; }
+                bool operator!=(const iterator& it) const noexcept { return _rec < it._rec; }
+            private:
+                const replay_record* _rec;
+        };
+
+        // initialization
+        replay_reader() = default;
+        ~replay_reader();
+        replay_reader(const replay_reader&) = delete;
+        replay_reader& operator=(const replay_reader&) = delete;
+        bool Open(const std::string& path);
+        void Close() noexcept;
+
+        // iteration
+        iterator begin() const noexcept { return iterator(_First()); }
+        iterator end()   const noexcept { return iterator(_End()); }
+
+        // blocks
+        std::size_t Blocks() const noexcept { return _blocks.size(); }
+        iterator    BlockBegin(std::size_t b) const noexcept { return iterator(_At(_blocks[b])); }
+        iterator    BlockEnd(std::size_t b)   const noexcept { return (b + 1 < _blocks.size()) ? BlockBegin(b + 1) : end(); }
+
+        // get
+        std::size_t inline Bytes() const noexcept { return _size; }
+
+    private:
+        // auxiliary methods
+        const replay_record* _At(std::uint64_t offset) const noexcept
+        {
+            return _data ? reinterpret_cast<const replay_record*>(_data + offset) : nullptr;
+        }
+        const replay_record* _First() const noexcept { return _At(sizeof(replay_file_header)); }
+        const replay_record* _End()   const noexcept { return _At(_size); }
+
+        // instance variables
+        const char*                _data   = nullptr;
+        std::size_t                _size   = 0; // complete records only
+        std::size_t                _mapped = 0;
+        std::vector<std::uint64_t> _blocks; // block offsets (index file)
+};
+
+#endif /* __REPLAY_HPP__ */
\ No newline at end of file
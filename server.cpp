@@ -0,0 +1,384 @@
+//==============================================================================
+//
+// server.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Event loop game server on a Unix domain socket (Linux)
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "session.hpp"
+
+// server constants
+//******************************************************************************
+const std::size_t max_line   = 256;        // longest command line
+const std::size_t max_input  = 64 * 1024;  // received bytes kept before reading is paused
+const std::size_t max_output = 64 * 1024;  // reply bytes kept before the commands are paused
+const int         max_events = 256;        // events per wait
+
+// connection structure
+//------------------------------------------------------------------------------
+struct connection
+{
+    int         fd;
+    session     game;
+    std::string in;      // received bytes not processed yet
+    std::string out;     // reply bytes not sent yet
+    bool        ended;   // end of stream received
+    bool        closing; // close once the replies are sent
+    bool        reading; // EPOLLIN registered
+    bool        writing; // EPOLLOUT registered
+
+    connection(int socket, std::uint64_t seed, const montecarlo_config& mc)
+    : fd(socket), game(seed, mc), ended(false), closing(false), reading(true), writing(false)
+    {}
+};
+
+// server counters structure
+//------------------------------------------------------------------------------
+struct server_counters
+{
+    long accepted = 0;
+    long active   = 0;
+    long peak     = 0;
+    long commands = 0;
+    long refused  = 0;
+};
+
+volatile std::sig_atomic_t stop_flag = 0;
+
+// server functions
+//******************************************************************************
+void on_signal(int)
+{
+    stop_flag = 1;
+}
+
+//------------------------------------------------------------------------------
+void close_connection(int epfd, std::vector<std::unique_ptr<connection>>& conns, int fd, server_counters& cnt)
+{
+    epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    conns[fd].reset();
+    cnt.active--;
+}
+
+//------------------------------------------------------------------------------
+//
+// sends the pending replies, false on a connection error
+//
+bool flush_connection(connection& c)
+{
+    while(!c.out.empty())
+    {
+        ssize_t n = send(c.fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+        if(n < 0)
+        {
+            if(errno == EINTR) continue;
+            if(errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+        c.out.erase(0, static_cast<std::size_t>(n));
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//
+// updates the events of the connection: the input is not read while the
+// replies or the received bytes are over their cap (backpressure on a client
+// that does not read its replies), nor after the end of stream; the socket is
+// waited writable while replies are pending
+//
+void watch_connection(int epfd, connection& c)
+{
+    bool reading = !c.closing && !c.ended && c.out.size() < max_output && c.in.size() < max_input;
+    bool writing = !c.out.empty();
+    if(reading == c.reading && writing == c.writing) return;
+    epoll_event ev{};
+    ev.events  = reading ? EPOLLIN | EPOLLRDHUP : 0;
+    if(writing) ev.events |= EPOLLOUT;
+    ev.data.fd = c.fd;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, c.fd, &ev);
+    c.reading = reading;
+    c.writing = writing;
+}
+
+//------------------------------------------------------------------------------
+//
+// reads the available bytes up to the input cap, false on a connection error
+//
+bool read_connection(connection& c)
+{
+    char buffer[4096];
+    while(!c.ended && c.in.size() < max_input)
+    {
+        ssize_t n = recv(c.fd, buffer, sizeof(buffer), 0);
+        if(n == 0)
+        {
+            c.ended = true;
+            break;
+        }
+        if(n < 0)
+        {
+            if(errno == EINTR) continue;
+            if(errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+        // the input after quit is dropped
+        if(!c.closing) c.in.append(buffer, static_cast<std::size_t>(n));
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//
+// runs the complete command lines until the replies reach their cap; the
+// commands before the end of stream are still run
+//
+void run_connection(connection& c, server_counters& cnt)
+{
+    std::size_t start = 0, end = 0;
+    std::string line;
+    while(!c.closing && c.out.size() < max_output && (end = c.in.find('\n', start)) != std::string::npos)
+    {
+        line.assign(c.in, start, end - start);
+        start = end + 1;
+        cnt.commands++;
+        if(!c.game.Handle(line, c.out)) c.closing = true;
+    }
+    c.in.erase(0, start);
+    if(c.closing) c.in.clear();
+    else if(end == std::string::npos)
+    {
+        // no complete line left
+        if(c.in.size() > max_line)
+        {
+            c.out    += "error line length\n";
+            c.closing = true;
+            c.in.clear();
+        }
+        else if(c.ended) c.closing = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+int open_listener(const std::string& path)
+{
+    sockaddr_un addr{};
+    if(path.size() >= sizeof(addr.sun_path)) return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(fd < 0) return -1;
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    unlink(path.c_str());
+    if(bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+//------------------------------------------------------------------------------
+void raise_file_limit()
+{
+    rlimit lim;
+    if(getrlimit(RLIMIT_NOFILE, &lim) == 0 && lim.rlim_cur < lim.rlim_max)
+    {
+        lim.rlim_cur = lim.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &lim);
+    }
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_server [-u path] [-s seed] [-m us] [-M samples]\n";
+    std::cout << "\n";
+    std::cout << "    -u path      Unix domain socket path (default /tmp/battleship.sock)\n";
+    std::cout << "    -s seed      master seed of the session seeds (default: random)\n";
+    std::cout << "    -m us        montecarlo budget per move in microseconds (default 1000)\n";
+    std::cout << "    -M samples   montecarlo samples cap per move (default: budget only)\n";
+    std::cout << "\n";
+    std::cout << "    One event loop thread serves all the sessions: a montecarlo move\n";
+    std::cout << "    holds the loop for its whole budget.\n";
+    std::cout << "\n";
+    std::cout << "    protocol (one reply line per command):\n";
+    std::cout << "        new [seed] [strategy]      ok new <seed> <strategy>\n";
+    std::cout << "        place [c1r b3d ...]        ok place <ocean>\n";
+    std::cout << "        place external             ok place external      (the client keeps its fleet)\n";
+    std::cout << "        fire <cell>                ok fire <cell> <result> [reply <cell> <result>] [win <side>]\n";
+    std::cout << "                                   ok fire <cell> <result> [shot <cell>] [win remote]  (external)\n";
+    std::cout << "        result <miss|hit|sunk ship>\n";
+    std::cout << "                                   ok result [win computer]  (external: outcome of the shot)\n";
+    std::cout << "        board                      ok board <ocean> <target>\n";
+    std::cout << "        quit                       ok quit\n";
+    std::cout << std::endl;
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::string path = "/tmp/battleship.sock";
+    std::uint64_t seed = thread_rng().Next();
+    montecarlo_config mc;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-u") && i + 1 < argc)      path = argv[++i];
+        else if(!std::strcmp(argv[i], "-s") && i + 1 < argc) seed = std::strtoull(argv[++i], nullptr, 10);
+        else if(!std::strcmp(argv[i], "-m") && i + 1 < argc) mc.budget      = std::chrono::microseconds(std::atol(argv[++i]));
+        else if(!std::strcmp(argv[i], "-M") && i + 1 < argc) mc.max_samples = std::atol(argv[++i]);
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    // open the listener
+    raise_file_limit();
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    std::signal(SIGPIPE, SIG_IGN);
+    int lfd = open_listener(path);
+    if(lfd < 0)
+    {
+        std::cerr << "cannot listen on " << path << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    int spare = open("/dev/null", O_RDONLY | O_CLOEXEC); // descriptor kept for EMFILE
+    int epfd  = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event ev{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = lfd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, lfd, &ev);
+    std::cerr << "listening on " << path << std::endl;
+
+    // event loop
+    rng seeds(seed);
+    server_counters cnt;
+    std::vector<std::unique_ptr<connection>> conns; // by file descriptor
+    epoll_event events[max_events];
+    while(!stop_flag)
+    {
+        int n = epoll_wait(epfd, events, max_events, -1);
+        if(n < 0)
+        {
+            if(errno == EINTR) continue;
+            break;
+        }
+        for(int k = 0; k < n; ++k)
+        {
+            int fd = events[k].data.fd;
+            // new sessions
+            if(fd == lfd)
+            {
+                for(;;)
+                {
+                    int cfd = accept4(lfd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if(cfd < 0)
+                    {
+                        if(errno == EINTR) continue;
+                        if((errno != EMFILE && errno != ENFILE) || spare < 0) break;
+                        // out of descriptors: the spare one makes room to refuse the
+                        // client, else the listener stays readable and the loop spins
+                        close(spare);
+                        cfd = accept(lfd, nullptr, nullptr);
+                        if(cfd >= 0) close(cfd);
+                        spare = open("/dev/null", O_RDONLY | O_CLOEXEC);
+                        cnt.refused++;
+                        if(cfd < 0) break;
+                        continue;
+                    }
+                    if(static_cast<std::size_t>(cfd) >= conns.size()) conns.resize(cfd + 1);
+                    conns[cfd].reset(new connection(cfd, seeds.Next(), mc));
+                    epoll_event cev{};
+                    cev.events  = EPOLLIN | EPOLLRDHUP;
+                    cev.data.fd = cfd;
+                    epoll_ctl(epfd, EPOLL_CTL_ADD, cfd, &cev);
+                    cnt.accepted++;
+                    if(++cnt.active > cnt.peak) cnt.peak = cnt.active;
+                }
+                continue;
+            }
+            // session traffic
+            connection* c = conns[fd].get();
+            if(!c) continue;
+            bool alive = !(events[k].events & EPOLLERR);
+            if(alive && c->reading && (events[k].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP))) alive = read_connection(*c);
+            // the paused commands resume as the replies are sent; the replies of
+            // a closed stream are still sent
+            while(alive)
+            {
+                run_connection(*c, cnt);
+                if(!flush_connection(*c)) alive = false;
+                if(c->closing || c->out.size() >= max_output || c->in.find('\n') == std::string::npos) break;
+            }
+            if(!alive || (c->closing && c->out.empty())) close_connection(epfd, conns, fd, cnt);
+            else watch_connection(epfd, *c);
+        }
+    }
+
+    // shutdown
+    for(std::size_t fd = 0; fd < conns.size(); ++fd)
+    {
+        if(conns[fd]) close_connection(epfd, conns, static_cast<int>(fd), cnt);
+    }
+    close(epfd);
+    close(lfd);
+    if(spare >= 0) close(spare);
+    unlink(path.c_str());
+    std::cerr << "sessions " << cnt.accepted << " (peak " << cnt.peak << "), commands " << cnt.commands << ", refused " << cnt.refused << std::endl;
+    // program end
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,354 @@
+//==============================================================================
+//
+// session.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Text protocol game session implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cctype>
+#include <cstdlib>
+#include "session.hpp"
+
+// session constants
+//******************************************************************************
+static const char* const result_name[] = { "invalid", "miss", "hit", "sunk" };
+
+// session functions
+//******************************************************************************
+bool sunk_cells(const bitboard& open, int ship, int cell, bitboard& cells) noexcept
+{
+    int size = ship_size[ship], row = cell / FIELD_COLS, col = cell % FIELD_COLS, found = 0;
+    for(int vertical = 0; vertical < 2; ++vertical)
+    {
+        for(int k = 0; k < size; ++k)
+        {
+            // placement with the cell at offset k
+            int r0 = vertical ? row - k : row, c0 = vertical ? col : col - k;
+            bitboard mask;
+            bool     fits = true;
+            for(int i = 0; i < size && fits; ++i)
+            {
+                int r = vertical ? r0 + i : r0, c = vertical ? c0 : c0 + i;
+                fits = r >= 0 && r < FIELD_ROWS && c >= 0 && c < FIELD_COLS && open.Test(cell_index(r, c));
+                if(fits) mask.Set(cell_index(r, c));
+            }
+            if(!fits) continue;
+            cells = mask;
+            found++;
+        }
+    }
+    return found == 1;
+}
+
+// Session class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+session::session(std::uint64_t seed, const montecarlo_config& mc) noexcept
+: _rng(seed), _mc(mc), _computer(make_strategy(strategy_classic)), _variant{ "classic", strategy_classic, mc },
+  _engine(_remote, _computer.Player()), _state(session_idle), _closed(false),
+  _external(false), _pending(-1), _tokens(0)
+{}
+
+//------------------------------------------------------------------------------
+bool session::SetStrategy(int strategy) noexcept
+{
+    if(strategy < 0 || strategy >= static_cast<int>(strategy_name.size())) return false;
+    _variant = strategy_variant{ strategy_name[strategy], strategy, _mc };
+    return true;
+}
+
+// protocol
+//------------------------------------------------------------------------------
+bool session::Handle(const std::string& line, std::string& out)
+{
+    if(_closed) return false;
+    // empty lines are not answered
+    if(_Split(line) == 0) return true;
+    const std::string& cmd = _token[0];
+    if(cmd == "new")        _New(out);
+    else if(cmd == "place") _Place(out);
+    else if(cmd == "fire")  _Fire(out);
+    else if(cmd == "result") _Result(out);
+    else if(cmd == "board") _Board(out);
+    else if(cmd == "quit")
+    {
+        out    += "ok quit\n";
+        _closed = true;
+    }
+    else out += "error " + cmd + " unknown\n";
+    return !_closed;
+}
+
+// commands
+//------------------------------------------------------------------------------
+void session::_New(std::string& out)
+{
+    // seed and strategy of the game
+    std::uint64_t seed = (_tokens > 1) ? std::strtoull(_token[1].c_str(), nullptr, 10) : _rng.Next();
+    strategy_variant variant = _variant;
+    if(_tokens > 2 && !parse_strategy_variant(_token[2], _mc, variant))
+    {
+        out += "error new strategy\n";
+        return;
+    }
+    // make the players on the game seed
+    rng game_rng(seed);
+    _computer = make_strategy(variant.strategy);
+    _variant  = variant;
+    if(computer* ai = _computer.Computer()) ai->SetMonteCarlo(_variant.mc);
+    _remote.Reset();
+    _remote.Seed(game_rng.Next());
+    _computer.Player().Seed(game_rng.Next());
+    _computer.Place();
+    _engine   = engine(_remote, _computer.Player());
+    _state    = session_placing;
+    _external = false;
+    _pending  = -1;
+    out += "ok new " + std::to_string(seed) + ' ' + _variant.label + '\n';
+}
+
+//------------------------------------------------------------------------------
+void session::_Place(std::string& out)
+{
+    if(_state != session_placing)
+    {
+        out += "error place state\n";
+        return;
+    }
+    if(_tokens == 1) _remote.InitRandom();
+    else if(_tokens == 2 && _token[1] == "external")
+    {
+        // the client fleet is not known: the computer shots are answered by result
+        _remote.Reset();
+        _external = true;
+        _state    = session_playing;
+        out += "ok place external\n";
+        return;
+    }
+    else
+    {
+        // one anchor and direction per ship, in the fleet order
+        bool valid = (_tokens == destroier_idx + 1);
+        _remote.Reset();
+        for(int s = carrier_idx; valid && s <= destroier_idx; ++s)
+        {
+            std::string& spec = _token[s];
+            int dir = 0;
+            switch(spec.size() < 3 ? '\0' : spec.back())
+            {
+                case 'l': dir = dir_left;  break;
+                case 'r': dir = dir_right; break;
+                case 'u': dir = dir_up;    break;
+                case 'd': dir = dir_down;  break;
+            }
+            spec.pop_back();
+            valid = (dir != 0) && _remote.InitShip(s, _remote.Cell(spec), dir);
+        }
+        if(!valid)
+        {
+            _remote.Reset();
+            out += "error place fleet\n";
+            return;
+        }
+    }
+    _state = session_playing;
+    out += "ok place ";
+    _AppendGrid(true, _remote, out);
+    out += '\n';
+}
+
+//------------------------------------------------------------------------------
+void session::_Fire(std::string& out)
+{
+    if(_state != session_playing)
+    {
+        out += "error fire state\n";
+        return;
+    }
+    // the remote shot
+    int cell = (_tokens == 2) ? _remote.Cell(_token[1]) : -1;
+    step_result res{ first_side, shot_invalid, -1, '\0', false, empty_idx };
+    if(cell >= 0) res = _external ? play_shot(_remote, _computer.Player(), first_side, cell) : _engine.Step(cell);
+    if(res.outcome == shot_invalid)
+    {
+        out += "error fire cell\n";
+        return;
+    }
+    out += "ok fire ";
+    _AppendResult(res, out);
+    if(_external)
+    {
+        // the computer shot, answered by the client with result
+        if(res.end)
+        {
+            _state = session_over;
+            out += " win remote\n";
+            return;
+        }
+        _pending = _computer.FireCell();
+        if(_pending < 0)
+        {
+            // no cell left: the results given by the client were inconsistent
+            _state = session_over;
+            out += " win remote\n";
+            return;
+        }
+        _state = session_result;
+        out += " shot ";
+        out += cell_position(_pending);
+        out += '\n';
+        return;
+    }
+    // the computer reply
+    if(!_engine.End())
+    {
+        out += " reply ";
+        _AppendResult(_engine.Step(_computer.FireCell()), out);
+    }
+    if(_engine.End())
+    {
+        _state = session_over;
+        out += (_engine.Winner() == first_side) ? " win remote" : " win computer";
+    }
+    out += '\n';
+}
+
+//------------------------------------------------------------------------------
+void session::_Result(std::string& out)
+{
+    if(_state != session_result)
+    {
+        out += "error result state\n";
+        return;
+    }
+    // outcome of the pending computer shot
+    player&  ai   = _computer.Player();
+    int      ship = empty_idx;
+    bitboard cells;
+    bool     valid = (_tokens == 2 && (_token[1] == "miss" || _token[1] == "hit"));
+    if(_tokens == 3 && _token[1] == "sunk")
+    {
+        for(int s = carrier_idx; s <= destroier_idx; ++s)
+        {
+            if(_LowerName(s) == _token[2]) ship = s;
+        }
+        valid = (ship != empty_idx) && !ai.IsSunk(ship);
+    }
+    if(!valid)
+    {
+        out += "error result outcome\n";
+        return;
+    }
+    ai.SetTargetGrid(_pending, (_token[1] == "miss") ? shot_mark[empty_idx] : shot_mark[hit_idx]);
+    // a sunk ship is revealed when its cells are known
+    if(ship != empty_idx && sunk_cells(ai.OpenHits(), ship, _pending, cells)) ai.SetSunk(ship, cells);
+    _pending = -1;
+    _state   = session_playing;
+    out += "ok result";
+    if(ai.End())
+    {
+        _state = session_over;
+        out += " win computer";
+    }
+    out += '\n';
+}
+
+//------------------------------------------------------------------------------
+void session::_Board(std::string& out)
+{
+    if(_state == session_idle)
+    {
+        out += "error board state\n";
+        return;
+    }
+    out += "ok board ";
+    _AppendGrid(true, _remote, out);
+    out += ' ';
+    _AppendGrid(false, _remote, out);
+    out += '\n';
+}
+
+// auxiliary methods
+//------------------------------------------------------------------------------
+int session::_Split(const std::string& line)
+{
+    _tokens = 0;
+    std::size_t i = 0, n = line.size();
+    while(i < n && _tokens < 8)
+    {
+        while(i < n && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r')) ++i;
+        std::size_t start = i;
+        while(i < n && line[i] != ' ' && line[i] != '\t' && line[i] != '\r') ++i;
+        if(i > start) _token[_tokens++].assign(line, start, i - start);
+    }
+    return _tokens;
+}
+
+//------------------------------------------------------------------------------
+void session::_AppendResult(const step_result& res, std::string& out)
+{
+    out += cell_position(res.cell);
+    out += ' ';
+    if(res.sunk != empty_idx)
+    {
+        out += "sunk ";
+        out += _LowerName(res.sunk);
+    }
+    else out += result_name[res.outcome];
+}
+
+//------------------------------------------------------------------------------
+std::string session::_LowerName(int ship)
+{
+    std::string name = ship_name[ship];
+    for(char& c : name) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return name;
+}
+
+//------------------------------------------------------------------------------
+void session::_AppendGrid(bool ocean, player& p, std::string& out)
+{
+    for(int row = 0; row < FIELD_ROWS; ++row)
+    {
+        for(int col = 0; col < FIELD_COLS; ++col)
+        {
+            char mark = ocean ? p.GetOceanGrid(row, col) : p.GetTargetGrid(row, col);
+            out += (mark == ' ') ? '-' : mark;
+        }
+    }
+}
\ No newline at end of file
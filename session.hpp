@@ -0,0 +1,147 @@
+//==============================================================================
+//
+// session.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Text protocol game session header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __SESSION_HPP__
+#define __SESSION_HPP__
+
+#include <cstdint>
+#include <string>
+#include "engine.hpp"
+#include "random.hpp"
+#include "strategy.hpp"
+
+// session states
+//------------------------------------------------------------------------------
+enum session_state { session_idle = 0, session_placing = 1, session_playing = 2, session_over = 3, session_result = 4 };
+
+// session functions
+//------------------------------------------------------------------------------
+//
+// cells of the ship sunk by the shot on 'cell' when the antagonist fleet is
+// not known: the only placement of the ship through the cell on the open hits
+// (hit, not sunk yet), false if there is none or more than one
+//
+bool sunk_cells(const bitboard& open, int ship, int cell, bitboard& cells) noexcept;
+
+// remote player class
+//------------------------------------------------------------------------------
+//
+// the side played by the client: its fleet is kept by the session, its shots
+// come from the protocol
+//
+class remote_player final : public player
+{
+    public:
+        remote_player() : player("Remote") {}
+};
+
+// session class
+//------------------------------------------------------------------------------
+//
+// One client game against a computer strategy, driven by text commands: no
+// terminal I/O and no blocking, each command line is answered at once by one
+// reply line, so the commands can be pipelined.
+//
+//   new [seed] [strategy]  -> ok new <seed> <strategy>
+//   place                  -> ok place <ocean>          (random fleet)
+//   place <ship> x 5       -> ok place <ocean>          (ship = c5r: anchor and l/r/u/d)
+//   place external         -> ok place external         (the client keeps its fleet)
+//   fire <cell>            -> ok fire <cell> <result> [reply <cell> <result>] [win remote|computer]
+//                             ok fire <cell> <result> [shot <cell>] [win remote]   (external fleet)
+//   result <result>        -> ok result [win computer]  (external fleet: outcome of the shot)
+//   board                  -> ok board <ocean> <target>
+//   quit                   -> ok quit
+//
+// new keeps the strategy of the previous game (classic) when none is given;
+// result is miss, hit or sunk <ship>; ocean and target are the 100 grid marks
+// row by row ('-' for an empty cell). With an external fleet each computer
+// shot must be answered by result before the next fire, and a computer left
+// without a cell to shoot (inconsistent results) loses. A command that cannot
+// be applied is answered by "error <command> <reason>" and leaves the session
+// unchanged.
+//
+class session
+{
+    public:
+        // initialization
+        session(std::uint64_t seed = 0, const montecarlo_config& mc = montecarlo_config()) noexcept;
+
+        // protocol: one command line (without the end of line), the reply line
+        // is appended to out; false once the session is closed (quit)
+        bool Handle(const std::string& line, std::string& out);
+
+        // strategy of the next game (strategy_index), false if not a strategy
+        bool SetStrategy(int strategy) noexcept;
+
+        // get
+        int  inline State()  const noexcept { return _state; }
+        bool inline Closed() const noexcept { return _closed; }
+
+    private:
+        // commands
+        void _New(std::string& out);
+        void _Place(std::string& out);
+        void _Fire(std::string& out);
+        void _Result(std::string& out);
+        void _Board(std::string& out);
+
+        // auxiliary methods
+        int  _Split(const std::string& line);
+        void _AppendResult(const step_result& res, std::string& out);
+        void _AppendGrid(bool ocean, player& p, std::string& out);
+        static std::string _LowerName(int ship);
+
+        // instance variables
+        rng               _rng;       // game seeds
+        montecarlo_config _mc;
+        remote_player     _remote;
+        any_strategy      _computer;
+        strategy_variant  _variant;
+        engine            _engine;
+        int               _state;
+        bool              _closed;
+        bool              _external;  // the client keeps its fleet
+        int               _pending;   // computer shot waiting for its result
+        std::string       _token[8];
+        int               _tokens;
+};
+
+#endif /* __SESSION_HPP__ */
\ No newline at end of file
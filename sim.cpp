@@ -0,0 +1,301 @@
+//==============================================================================
+//
+// sim.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Computer vs computer self-play simulator
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "computer.hpp"
+#include "engine.hpp"
+#include "replay.hpp"
+#include "strategy.hpp"
+#include "tally.hpp"
+#include "thread_pool.hpp"
+
+// simulation constants
+//******************************************************************************
+// board variants: compile-time instantiations of the board templates,
+// selected at run time
+typedef basic_player<8,  8,  small_fleet> small_board;
+typedef basic_player<16, 16, large_fleet> large_board;
+
+enum variant_index { variant_classic = 0, variant_small = 1, variant_large = 2 };
+
+const std::vector<std::string> variant_name = { "10x10", "8x8", "16x16" };
+
+// simulation functions
+//******************************************************************************
+template<class S>
+void configure(S& s, const montecarlo_config& mc)
+{
+    if constexpr(std::is_base_of<computer, S>::value) s.SetMonteCarlo(mc);
+}
+
+//------------------------------------------------------------------------------
+//
+// game between two strategies (static dispatch)
+//
+template<class First, class Second>
+void play_match(First& first, Second& second, std::uint64_t seed, std::uint64_t id,
+                const montecarlo_config& mc, game_tally& acc, replay_writer* log)
+{
+    // seed the players on the game stream
+    std::uint64_t game_seed = rng::Stream(seed, id).Next();
+    rng      game_rng(game_seed);
+    configure(first, mc);
+    configure(second, mc);
+    match<First, Second> game(first, second);
+    first.Seed(game_rng.Next());
+    second.Seed(game_rng.Next());
+    first.First::Place();
+    second.Second::Place();
+    // play the game
+    thread_local replay_game replay;
+    if(log) replay.Start(game_seed, first, second);
+    int steps = 0;
+    while(!game.End() && steps < max_game_shots(field_cells))
+    {
+        step_result res = game.Play();
+        if(log) replay.Add(res);
+        steps++;
+    }
+    if(log) log->Append(replay);
+    acc.Collect(game);
+}
+
+//------------------------------------------------------------------------------
+void play_game(std::uint64_t seed, std::uint64_t id, const int strategies[2],
+               const montecarlo_config& mc, game_tally& acc, replay_writer* log)
+{
+    with_strategy(strategies[first_side], [&](auto& first)
+    {
+        with_strategy(strategies[second_side], [&](auto& second)
+        {
+            play_match(first, second, seed, id, mc, acc, log);
+        });
+    });
+}
+
+//------------------------------------------------------------------------------
+//
+// game on a board variant, both sides hunting around their hits
+//
+template<class Board>
+void play_variant(std::uint64_t seed, std::uint64_t id, game_tally& acc)
+{
+    // make the players on the game stream
+    rng                 game_rng = rng::Stream(seed, id);
+    Board               first, second;
+    basic_engine<Board> game(first, second);
+    first.Seed(game_rng.Next());
+    second.Seed(game_rng.Next());
+    first.InitRandom();
+    second.InitRandom();
+    // play the game
+    int steps = 0;
+    while(!game.End() && steps < max_game_shots(Board::cells))
+    {
+        game.Step(game.Player(game.Turn()).HuntTarget());
+        steps++;
+    }
+    acc.Collect(game);
+}
+
+//------------------------------------------------------------------------------
+int percentile(const std::vector<long>& hist, long total, double p)
+{
+    long target = static_cast<long>(p * total);
+    long count  = 0;
+    for(std::size_t i = 0; i < hist.size(); ++i)
+    {
+        count += hist[i];
+        if(count > target) return static_cast<int>(i);
+    }
+    return static_cast<int>(hist.size()) - 1;
+}
+
+//------------------------------------------------------------------------------
+int parse_variant(const std::string& name)
+{
+    for(std::size_t i = 0; i < variant_name.size(); ++i)
+    {
+        if(variant_name[i] == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_sim [-n games] [-t threads] [-c chunk] [-s seed] [-a strategy] [-b strategy] [-m us] [-M samples] [-p threads] [-v board] [-r log]\n";
+    std::cout << "\n";
+    std::cout << "    -n games     number of computer vs computer games (default 100000)\n";
+    std::cout << "    -t threads   number of worker threads (default: all cores)\n";
+    std::cout << "    -c chunk     games per scheduled task (default 256)\n";
+    std::cout << "    -s seed      master seed, game i is played on stream i (default: random)\n";
+    std::cout << "    -a strategy  first side strategy (default classic)\n";
+    std::cout << "    -b strategy  second side strategy (default classic)\n";
+    std::cout << "    -m us        montecarlo budget per move in microseconds (default 1000)\n";
+    std::cout << "    -M samples   montecarlo samples cap per move (default: budget only)\n";
+    std::cout << "    -p threads   montecarlo sampling threads per move, a pool shared by the games (default 1)\n";
+    std::cout << "    -v board     board variant (default 10x10; other boards play hunt vs hunt)\n";
+    std::cout << "    -r log       append the 10x10 games to a replay log\n";
+    std::cout << "\n";
+    std::cout << "    strategies      :";
+    for(const std::string& name : strategy_name) std::cout << ' ' << name;
+    std::cout << '\n';
+    std::cout << "    board variants  :";
+    for(const std::string& name : variant_name) std::cout << ' ' << name;
+    std::cout << '\n';
+    std::cout << std::endl;
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    long games   = 100000;
+    int  threads = 0;
+    long chunk   = 256;
+    std::uint64_t seed = thread_rng().Next();
+    int  strategies[2] = { strategy_classic, strategy_classic };
+    int  variant   = variant_classic;
+    int  samplers  = 1;
+    std::string log_path;
+    montecarlo_config mc;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-n") && i + 1 < argc)      games   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-t") && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-c") && i + 1 < argc) chunk   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-s") && i + 1 < argc) seed    = std::strtoull(argv[++i], nullptr, 10);
+        else if(!std::strcmp(argv[i], "-a") && i + 1 < argc) strategies[first_side]  = parse_strategy(argv[++i]);
+        else if(!std::strcmp(argv[i], "-b") && i + 1 < argc) strategies[second_side] = parse_strategy(argv[++i]);
+        else if(!std::strcmp(argv[i], "-m") && i + 1 < argc) mc.budget      = std::chrono::microseconds(std::atol(argv[++i]));
+        else if(!std::strcmp(argv[i], "-M") && i + 1 < argc) mc.max_samples = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-p") && i + 1 < argc) samplers = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-v") && i + 1 < argc) variant = parse_variant(argv[++i]);
+        else if(!std::strcmp(argv[i], "-r") && i + 1 < argc) log_path = argv[++i];
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if(strategies[first_side] < 0 || strategies[second_side] < 0 || variant < 0 || samplers < 1 || (!log_path.empty() && variant != variant_classic))
+    {
+        usage();
+        return 1;
+    }
+
+    // open the replay log
+    replay_writer  writer;
+    replay_writer* log = nullptr;
+    if(!log_path.empty())
+    {
+        if(!writer.Open(log_path))
+        {
+            std::cerr << "cannot open the replay log " << log_path << std::endl;
+            return 1;
+        }
+        log = &writer;
+    }
+
+    // run the simulation, the montecarlo moves sampled on their own pool
+    std::unique_ptr<thread_pool> sampling;
+    if(samplers > 1)
+    {
+        sampling.reset(new thread_pool(samplers));
+        mc.pool = sampling.get();
+    }
+    thread_pool pool(threads);
+    std::vector<game_tally> acc(pool.Size(), game_tally(large_board::cells));
+    auto t0 = std::chrono::steady_clock::now();
+    pool.ParallelFor(games, chunk, [&acc, &strategies, &mc, seed, variant, log](std::size_t begin, std::size_t end, int worker)
+    {
+        for(std::size_t g = begin; g < end; ++g)
+        {
+            switch(variant)
+            {
+                case variant_small: play_variant<small_board>(seed, g, acc[worker]); break;
+                case variant_large: play_variant<large_board>(seed, g, acc[worker]); break;
+                default:            play_game(seed, g, strategies, mc, acc[worker], log); break;
+            }
+        }
+    });
+    auto t1 = std::chrono::steady_clock::now();
+    if(log && !writer.Close()) std::cerr << "error writing the replay log " << log_path << std::endl;
+
+    // merge the results
+    game_tally tot(large_board::cells);
+    for(const game_tally& a : acc) tot.Merge(a);
+    long   completed = tot.games - tot.aborted;
+    double seconds   = std::chrono::duration<double>(t1 - t0).count();
+
+    // print the report
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "    seed            : " << seed << '\n';
+    std::cout << "    board           : " << variant_name[variant] << '\n';
+    if(variant == variant_classic)
+        std::cout << "    players         : " << strategy_name[strategies[first_side]] << " vs " << strategy_name[strategies[second_side]] << '\n';
+    else
+        std::cout << "    players         : hunt vs hunt\n";
+    std::cout << "    threads         : " << pool.Size() << '\n';
+    std::cout << "    games           : " << tot.games << " (" << tot.aborted << " aborted)\n";
+    std::cout << "    elapsed         : " << seconds << " s\n";
+    std::cout << "    throughput      : " << tot.games / seconds << " games/s\n";
+    if(completed > 0)
+    {
+        std::cout << "    shots to win    : mean " << static_cast<double>(tot.total_shots) / completed
+                  << ", p50 " << percentile(tot.shots_to_win, completed, 0.50)
+                  << ", p90 " << percentile(tot.shots_to_win, completed, 0.90)
+                  << ", p99 " << percentile(tot.shots_to_win, completed, 0.99) << '\n';
+        std::cout << "    first side wins : " << 100. * tot.first_wins / completed << " %\n";
+    }
+    std::cout << std::endl;
+    // program end
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+//==============================================================================
+//
+// snapshot.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Binary game snapshot implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cstdio>
+#include "snapshot.hpp"
+#include "strategy.hpp"
+
+// snapshot functions
+//******************************************************************************
+bool save_snapshot(const std::string& path, const game_snapshot& snap) noexcept
+{
+    // write to a temporary file, then replace the snapshot
+    std::string tmp = path + ".tmp";
+    std::FILE* f = std::fopen(tmp.c_str(), "wb");
+    if(!f) return false;
+    bool ok = std::fwrite(&snap, sizeof(snap), 1, f) == 1;
+    ok &= std::fclose(f) == 0;
+    if(ok) ok = std::rename(tmp.c_str(), path.c_str()) == 0;
+    if(!ok) std::remove(tmp.c_str());
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+bool load_snapshot(const std::string& path, game_snapshot& snap) noexcept
+{
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if(!f) return false;
+    bool ok = std::fread(&snap, sizeof(snap), 1, f) == 1;
+    std::fclose(f);
+    return ok && check_snapshot(snap);
+}
+
+//------------------------------------------------------------------------------
+static bool check_player(const player_state& p) noexcept
+{
+    // every grid inside the field
+    const bitboard* grids[] = { &p.fleet_mask, &p.ocean_hit, &p.target_miss, &p.target_hit, &p.target_sunk };
+    for(const bitboard* g : grids)
+    {
+        if((*g & ~field_mask).Any()) return false;
+    }
+    // disjoint ships of the fleet sizes (no ship before the initialization)
+    bitboard fleet;
+    if(p.ship_mask[empty_idx].Any()) return false;
+    for(int s = carrier_idx; s <= destroier_idx; ++s)
+    {
+        const bitboard& ship = p.ship_mask[s];
+        if((ship & ~field_mask).Any() || (ship & fleet).Any()) return false;
+        if(ship.Any() && ship.Count() != ship_size[s]) return false;
+        fleet |= ship;
+    }
+    if(!(fleet == p.fleet_mask) || (p.ocean_hit & ~fleet).Any()) return false;
+    if((p.target_miss & p.target_hit).Any() || (p.target_sunk & ~p.target_hit).Any()) return false;
+    // counters
+    if(p.hit_counter < 0 || p.hit_counter > classic_fleet::cells) return false;
+    if(p.sunk_ships & ~0x3e) return false;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool check_grid_point(std::int32_t row, std::int32_t col, bool hit_mode) noexcept
+{
+    int low = hit_mode ? 0 : -1;
+    return row >= low && row < FIELD_ROWS && col >= low && col < FIELD_COLS;
+}
+
+//------------------------------------------------------------------------------
+bool check_snapshot(const game_snapshot& snap) noexcept
+{
+    // header
+    if(snap.magic != snapshot_magic || snap.version != snapshot_version || snap.size != sizeof(game_snapshot)) return false;
+    // players
+    if(!check_player(snap.user) || !check_player(snap.computer)) return false;
+    // engine
+    const engine_state& e = snap.engine;
+    if(e.turn != first_side && e.turn != second_side) return false;
+    if(e.winner != no_side && e.winner != first_side && e.winner != second_side) return false;
+    for(int side = 0; side < 2; ++side)
+    {
+        if(e.shots[side] < 0 || e.shots[side] > field_cells) return false;
+    }
+    // strategy and computer targeting state
+    const computer_state& ai = snap.ai;
+    if(ai.level < 0 || ai.level >= static_cast<int>(strategy_name.size())) return false;
+    if(ai.level > strategy_montecarlo) return true; // no targeting state
+    if(ai.dir < dir_left || ai.dir > dir_down || ai.dir_changes < 0) return false;
+    if(!check_grid_point(ai.first_row, ai.first_col, ai.hit_mode != 0)) return false;
+    if(!check_grid_point(ai.last_row,  ai.last_col,  ai.hit_mode != 0)) return false;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+//==============================================================================
+//
+// snapshot.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Binary game snapshot header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __SNAPSHOT_HPP__
+#define __SNAPSHOT_HPP__
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "computer.hpp"
+#include "engine.hpp"
+
+// snapshot constants
+//------------------------------------------------------------------------------
+const std::uint32_t snapshot_magic   = 0x50534253; // "BSSP"
+const std::uint32_t snapshot_version = 2;
+
+// player state structure
+//------------------------------------------------------------------------------
+struct player_state
+{
+    bitboard      ship_mask[destroier_idx + 1]; // ocean grid: cells occupied by each ship
+    bitboard      fleet_mask;                   // ocean grid: union of the ship masks
+    bitboard      ocean_hit;                    // ocean grid: ship cells hit by the antagonist
+    bitboard      target_miss;                  // target grid: missed shots on the antagonist
+    bitboard      target_hit;                   // target grid: hit shots on the antagonist
+    bitboard      target_sunk;                  // target grid: cells of the sunk antagonist ships
+    std::uint64_t rng[4];                       // random generator state
+    std::int32_t  hit_counter;
+    std::int32_t  initialization;
+    std::int32_t  sunk_ships;                   // bit s set if the antagonist ship s was sunk
+    std::int32_t  reserved;
+};
+
+// computer state structure
+//------------------------------------------------------------------------------
+struct computer_state
+{
+    std::int32_t level;
+    std::int32_t hit_mode;
+    std::int32_t first_row, first_col;
+    std::int32_t last_row,  last_col;
+    std::int32_t dir, dir_changes;
+    std::int32_t miss_counter, hit_counter;
+};
+
+// engine state structure
+//------------------------------------------------------------------------------
+struct engine_state
+{
+    std::int32_t turn;
+    std::int32_t winner;
+    std::int32_t shots[2];
+};
+
+// game snapshot structure
+//------------------------------------------------------------------------------
+//
+// Fixed-size image of a user vs computer game, written and read as a whole
+// (native byte order). Loading is a single read plus the header checks.
+//
+struct game_snapshot
+{
+    std::uint32_t  magic;
+    std::uint32_t  version;
+    std::uint32_t  size;     // sizeof(game_snapshot)
+    std::uint32_t  reserved;
+    std::uint64_t  seed;     // game seed
+    player_state   user;
+    player_state   computer;
+    computer_state ai;
+    engine_state   engine;
+};
+
+static_assert(std::is_trivially_copyable<game_snapshot>::value, "snapshots are copied as raw bytes");
+
+// snapshot functions
+//------------------------------------------------------------------------------
+bool save_snapshot(const std::string& path, const game_snapshot& snap) noexcept;
+bool load_snapshot(const std::string& path, game_snapshot& snap) noexcept; // false on a non-valid snapshot
+bool check_snapshot(const game_snapshot& snap) noexcept;                    // header, grids and indices in range
+
+#endif /* __SNAPSHOT_HPP__ */
\ No newline at end of file
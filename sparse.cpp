@@ -0,0 +1,221 @@
+//==============================================================================
+//
+// sparse.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Sparse tiled board for very large oceans implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "sparse.hpp"
+
+// Sparse player class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+sparse_player::sparse_player(std::int64_t rows, std::int64_t cols, const std::vector<int>& sizes)
+: _rows(rows), _cols(cols), _tile_cols((cols + tile_side - 1) / tile_side), _sizes(sizes), _fleet_cells(0),
+  _target_miss(0), _target_hit(0), _rng(thread_rng().Next())
+{
+    if(rows <= 0 || cols <= 0) throw std::invalid_argument("sparse_player: empty board");
+    for(int size : _sizes)
+    {
+        if(size <= 0 || (size > rows && size > cols)) throw std::invalid_argument("sparse_player: ship larger than the board");
+        _fleet_cells += size;
+    }
+    // place the largest ships first
+    std::sort(_sizes.begin(), _sizes.end(), std::greater<int>());
+}
+
+// board initialization
+//------------------------------------------------------------------------------
+void sparse_player::Reset()
+{
+    _ships.clear();
+    _ocean.clear();
+    _target.clear();
+    _target_miss = 0;
+    _target_hit  = 0;
+}
+
+//------------------------------------------------------------------------------
+bool sparse_player::PlaceShip(std::int64_t row, std::int64_t col, int size, bool vertical)
+{
+    // check the position and the collisions
+    if(!_IsFree(row, col, size, vertical)) return false;
+    // assign the ship elements
+    _ships.push_back(sparse_ship{ row, col, size, vertical, size });
+    std::uint32_t id = static_cast<std::uint32_t>(_ships.size());
+    for(int k = 0; k < size; ++k)
+    {
+        std::int64_t r = vertical ? row + k : row;
+        std::int64_t c = vertical ? col     : col + k;
+        ocean_tile&  t = _ocean[_TileKey(r, c)];
+        int          b = _TileBit(r, c);
+        t.ship |= 1ull << b;
+        t.id[b] = id;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//
+// Every ship draws anchors until one does not collide: on a sparse ocean almost
+// every draw is accepted, so the cost per ship does not depend on the board
+// size. Returns false if a ship found no room in sparse_max_tries draws.
+//
+bool sparse_player::InitRandom()
+{
+    Reset();
+    _ocean.reserve(_fleet_cells);
+    for(int size : _sizes)
+    {
+        int tries;
+        for(tries = 0; tries < sparse_max_tries; ++tries)
+        {
+            bool vertical = (_rng.Next() & 1) != 0;
+            std::int64_t row_span = vertical ? _rows - size + 1 : _rows;
+            std::int64_t col_span = vertical ? _cols : _cols - size + 1;
+            if(row_span <= 0 || col_span <= 0) continue;
+            std::int64_t row = static_cast<std::int64_t>(_rng.Uniform() * row_span);
+            std::int64_t col = static_cast<std::int64_t>(_rng.Uniform() * col_span);
+            if(PlaceShip(row, col, size, vertical)) break;
+        }
+        if(tries == sparse_max_tries) return false;
+    }
+    return true;
+}
+
+// game play
+//------------------------------------------------------------------------------
+int sparse_player::Shoot(std::int64_t cell)
+{
+    std::int64_t row = cell / _cols, col = cell % _cols;
+    if(cell < 0 || !IsValidPosition(row, col)) return -1;
+    // untouched tiles are water
+    auto it = _ocean.find(_TileKey(row, col));
+    if(it == _ocean.end()) return miss_idx;
+    ocean_tile&   t   = it->second;
+    std::uint64_t bit = 1ull << _TileBit(row, col);
+    if(!(t.ship & bit)) return miss_idx;
+    // first hit on the cell: update the ship health
+    if(!(t.hit & bit))
+    {
+        t.hit |= bit;
+        _ships[t.id[_TileBit(row, col)] - 1].health--;
+    }
+    return hit_idx;
+}
+
+//------------------------------------------------------------------------------
+void sparse_player::Mark(std::int64_t cell, bool hit)
+{
+    std::int64_t  row = cell / _cols, col = cell % _cols;
+    target_tile&  t   = _target[_TileKey(row, col)];
+    std::uint64_t bit = 1ull << _TileBit(row, col);
+    if((t.miss | t.hit) & bit) return;
+    if(hit) { t.hit  |= bit; _target_hit++;  }
+    else    { t.miss |= bit; _target_miss++; }
+}
+
+// get
+//------------------------------------------------------------------------------
+char sparse_player::GetOceanGrid(std::int64_t row, std::int64_t col) const
+{
+    auto it = _ocean.find(_TileKey(row, col));
+    if(it == _ocean.end()) return shot_mark[empty_idx];
+    std::uint64_t bit = 1ull << _TileBit(row, col);
+    if(it->second.hit  & bit) return shot_mark[hit_idx];
+    if(it->second.ship & bit) return sparse_ship_mark;
+    return shot_mark[empty_idx];
+}
+
+//------------------------------------------------------------------------------
+char sparse_player::GetTargetGrid(std::int64_t row, std::int64_t col) const
+{
+    auto it = _target.find(_TileKey(row, col));
+    if(it == _target.end()) return shot_mark[empty_idx];
+    std::uint64_t bit = 1ull << _TileBit(row, col);
+    if(it->second.hit  & bit) return shot_mark[hit_idx];
+    if(it->second.miss & bit) return shot_mark[miss_idx];
+    return shot_mark[empty_idx];
+}
+
+// targeting
+//------------------------------------------------------------------------------
+std::int64_t sparse_player::RandomTarget()
+{
+    for(int tries = 0; tries < sparse_max_tries; ++tries)
+    {
+        std::int64_t row = static_cast<std::int64_t>(_rng.Uniform() * _rows);
+        std::int64_t col = static_cast<std::int64_t>(_rng.Uniform() * _cols);
+        if(GetTargetGrid(row, col) == shot_mark[empty_idx]) return row * _cols + col;
+    }
+    return -1;
+}
+
+// auxiliary methods
+//------------------------------------------------------------------------------
+bool sparse_player::_IsFree(std::int64_t row, std::int64_t col, int size, bool vertical) const
+{
+    // check the position
+    std::int64_t last_row = vertical ? row + size - 1 : row;
+    std::int64_t last_col = vertical ? col : col + size - 1;
+    if(!IsValidPosition(row, col) || !IsValidPosition(last_row, last_col)) return false;
+    // check the collisions, one tile lookup per crossed tile
+    std::int64_t k = 0;
+    while(k < size)
+    {
+        std::int64_t r = vertical ? row + k : row;
+        std::int64_t c = vertical ? col     : col + k;
+        // cells of the ship inside the current tile
+        std::int64_t in_tile = vertical ? tile_side - r % tile_side : tile_side - c % tile_side;
+        std::int64_t n       = std::min<std::int64_t>(in_tile, size - k);
+        auto it = _ocean.find(_TileKey(r, c));
+        if(it != _ocean.end())
+        {
+            for(std::int64_t j = 0; j < n; ++j)
+            {
+                int b = vertical ? _TileBit(r + j, c) : _TileBit(r, c + j);
+                if(it->second.ship & (1ull << b)) return false;
+            }
+        }
+        k += n;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+//==============================================================================
+//
+// sparse.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Sparse tiled board for very large oceans header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __SPARSE_HPP__
+#define __SPARSE_HPP__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "player.hpp"
+
+// sparse board constants
+//------------------------------------------------------------------------------
+const int  tile_side        = 8;   // tiles are 8 x 8 cells, one 64-bit word per grid
+const int  sparse_max_tries = 256; // placement draws per ship before giving up
+const char sparse_ship_mark = 'o'; // ocean grid mark of a ship cell
+
+// sparse tile structures
+//------------------------------------------------------------------------------
+//
+// bit (r % 8) * 8 + (c % 8) of the tile covering cell (r, c). Ocean tiles
+// also store the index (+1) of the ship on each occupied cell, target tiles
+// only the two shot masks.
+//
+struct ocean_tile
+{
+    std::uint64_t ship = 0;   // cells occupied by a ship
+    std::uint64_t hit  = 0;   // ship cells hit by the antagonist
+    std::uint32_t id[tile_side * tile_side]; // ship index + 1 of the occupied cells
+};
+
+struct target_tile
+{
+    std::uint64_t miss = 0;   // missed shots on the antagonist
+    std::uint64_t hit  = 0;   // hit shots on the antagonist
+};
+
+// sparse ship structure
+//------------------------------------------------------------------------------
+struct sparse_ship
+{
+    std::int64_t row, col; // anchor (top left cell)
+    int          size;
+    bool         vertical;
+    int          health;   // cells not hit yet
+};
+
+// sparse player class
+//------------------------------------------------------------------------------
+//
+// Player for very large oceans: the grids are hashed 8 x 8 tiles, only the
+// tiles touched by a ship or a shot are materialized. The ocean tiles are the
+// spatial index of the fleet, so placing a ship, checking a shot and marking
+// the target grid cost a few hash lookups whatever the board size. Cells are
+// 0-index and row major (cell = row * cols + col), as in basic_player, so the
+// class also fits basic_engine.
+//
+class sparse_player
+{
+    public:
+        // initialization
+        sparse_player(std::int64_t rows, std::int64_t cols, const std::vector<int>& sizes);
+        void Seed(std::uint64_t seed) noexcept { _rng.Seed(seed); }
+
+        // board initialization
+        void Reset();
+        bool PlaceShip(std::int64_t row, std::int64_t col, int size, bool vertical);
+        bool InitRandom();
+
+        // game play (see basic_player)
+        int  Shoot(std::int64_t cell);
+        void Mark(std::int64_t cell, bool hit);
+
+        // get (0-index rows and cols)
+        char GetOceanGrid(std::int64_t row, std::int64_t col) const;
+        char GetTargetGrid(std::int64_t row, std::int64_t col) const;
+        bool inline IsValidPosition(std::int64_t row, std::int64_t col) const noexcept
+        {
+            return row >= 0 && row < _rows && col >= 0 && col < _cols;
+        }
+
+        std::int64_t inline Rows()  const noexcept { return _rows; }
+        std::int64_t inline Cols()  const noexcept { return _cols; }
+        std::int64_t inline Cells() const noexcept { return _rows * _cols; }
+        std::size_t  inline Ships() const noexcept { return _ships.size(); }
+        const sparse_ship& Ship(std::size_t s) const noexcept { return _ships[s]; }
+
+        // counters
+        std::int64_t inline CountTargetMiss() const noexcept { return _target_miss; }
+        std::int64_t inline CountTargetHit()  const noexcept { return _target_hit; }
+        std::size_t  inline CountTiles()      const noexcept { return _ocean.size() + _target.size(); }
+
+        // game end: every cell of the antagonist fleet has been hit
+        bool inline End() const noexcept { return _target_hit >= _fleet_cells; }
+
+        // targeting: random cell not fired yet, -1 if the draws keep failing
+        std::int64_t RandomTarget();
+
+    private:
+        // auxiliary methods
+        std::uint64_t inline _TileKey(std::int64_t row, std::int64_t col) const noexcept
+        {
+            return static_cast<std::uint64_t>(row / tile_side) * _tile_cols + static_cast<std::uint64_t>(col / tile_side);
+        }
+        static int inline _TileBit(std::int64_t row, std::int64_t col) noexcept
+        {
+            return static_cast<int>((row % tile_side) * tile_side + (col % tile_side));
+        }
+        bool _IsFree(std::int64_t row, std::int64_t col, int size, bool vertical) const;
+
+        // instance variables
+        std::int64_t                                   _rows, _cols, _tile_cols;
+        std::vector<int>                               _sizes;       // fleet composition
+        std::int64_t                                   _fleet_cells; // sum of the ship sizes
+        std::vector<sparse_ship>                       _ships;       // placed ships
+        std::unordered_map<std::uint64_t, ocean_tile>  _ocean;       // ocean grid tiles
+        std::unordered_map<std::uint64_t, target_tile> _target;      // target grid tiles
+        std::int64_t                                   _target_miss;
+        std::int64_t                                   _target_hit;
+        rng                                            _rng;
+};
+
+#endif /* __SPARSE_HPP__ */
\ No newline at end of file
@@ -0,0 +1,328 @@
+//==============================================================================
+//
+// stats.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Parallel replay log analytics: shot and placement heatmaps
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "placement.hpp"
+#include "replay.hpp"
+#include "thread_pool.hpp"
+
+// statistics constants
+//******************************************************************************
+const int shot_bytes   = 256;                // shot byte values: cell | replay_hit_bit
+const int max_places   = 2 * field_cells;    // placements of the smallest ship, rounded up
+const int latency_bins = field_cells + 1;    // misses before the first hit
+const int win_bins     = replay_hit_bit + 1; // the last bin collects the longer games
+
+static_assert(placement_count(2) <= max_places, "placement counter size");
+static_assert(replay_stride * replay_max_shots <= 0xffffffffull, "block counter size");
+
+// block counter structure
+//------------------------------------------------------------------------------
+//
+// 32-bit counters of at most replay_stride games (flushed to the statistics
+// before they can wrap), indexed directly by the shot byte: misses in
+// [0, 128), hits in [128, 256)
+//
+struct alignas(64) block_counter
+{
+    std::uint32_t shot[shot_bytes];
+};
+
+// statistics structure
+//------------------------------------------------------------------------------
+//
+// per-worker results (cache line aligned), merged at the end of the scan
+//
+struct alignas(64) statistics
+{
+    std::uint64_t games      = 0;
+    std::uint64_t aborted    = 0;
+    std::uint64_t first_wins = 0;
+    std::uint64_t shot[shot_bytes]                     = {};
+    std::uint64_t place[destroier_idx + 1][max_places] = {};
+    std::uint64_t shots_to_win[win_bins]               = {};
+    std::uint64_t first_hit[latency_bins]              = {};
+
+    void Add(const block_counter& b)
+    {
+        // plain loops over fixed-size arrays: vectorized by the compiler
+        for(int i = 0; i < shot_bytes; ++i) shot[i] += b.shot[i];
+    }
+
+    void Merge(const statistics& s)
+    {
+        games      += s.games;
+        aborted    += s.aborted;
+        first_wins += s.first_wins;
+        for(int i = 0; i < shot_bytes; ++i) shot[i] += s.shot[i];
+        for(int k = 0; k <= destroier_idx; ++k)
+        {
+            for(int i = 0; i < max_places; ++i) place[k][i] += s.place[k][i];
+        }
+        for(int i = 0; i < win_bins; ++i)     shots_to_win[i] += s.shots_to_win[i];
+        for(int i = 0; i < latency_bins; ++i) first_hit[i]    += s.first_hit[i];
+    }
+};
+
+// statistics functions
+//******************************************************************************
+void scan_record(const replay_record& rec, block_counter& counter, statistics& st)
+{
+    const std::uint8_t* shots = rec.Shots();
+    int n = rec.shots;
+    // per-cell shots
+    for(int k = 0; k < n; ++k) counter.shot[shots[k]]++;
+    // placements
+    for(int side = first_side; side <= second_side; ++side)
+    {
+        for(int s = carrier_idx; s <= fleet_ships; ++s) st.place[s][rec.fleets[side].place[s - 1]]++;
+    }
+    // first hit latency (shots of the side before its first hit)
+    for(int side = first_side; side <= second_side; ++side)
+    {
+        int k;
+        for(k = side; k < n && !(shots[k] & replay_hit_bit); k += 2);
+        if(k < n) st.first_hit[(k / 2 < latency_bins) ? k / 2 : latency_bins - 1]++;
+    }
+    // result
+    st.games++;
+    if(rec.winner == replay_no_winner)
+    {
+        st.aborted++;
+        return;
+    }
+    if(rec.winner == first_side) st.first_wins++;
+    int won = (rec.winner == first_side) ? (n + 1) / 2 : n / 2;
+    st.shots_to_win[(won < win_bins) ? won : win_bins - 1]++;
+}
+
+//------------------------------------------------------------------------------
+void scan_block(replay_reader::iterator it, replay_reader::iterator end, statistics& st)
+{
+    block_counter counter;
+    std::memset(&counter, 0, sizeof(counter));
+    std::size_t games = 0;
+    for(; it != end; ++it)
+    {
+        scan_record(*it, counter, st);
+        if(++games % replay_stride == 0)
+        {
+            st.Add(counter);
+            std::memset(&counter, 0, sizeof(counter));
+        }
+    }
+    st.Add(counter);
+}
+
+//------------------------------------------------------------------------------
+template<class Counts>
+double hist_mean(const Counts& hist, int bins)
+{
+    double sum = 0, n = 0;
+    for(int i = 0; i < bins; ++i)
+    {
+        sum += static_cast<double>(i) * hist[i];
+        n   += hist[i];
+    }
+    return (n > 0) ? sum / n : 0.;
+}
+
+//------------------------------------------------------------------------------
+template<class Counts>
+int hist_percentile(const Counts& hist, int bins, double p)
+{
+    std::uint64_t total = 0, count = 0;
+    for(int i = 0; i < bins; ++i) total += hist[i];
+    for(int i = 0; i < bins; ++i)
+    {
+        count += hist[i];
+        if(count > p * total) return i;
+    }
+    return bins - 1;
+}
+
+//------------------------------------------------------------------------------
+//
+// print a 10x10 heatmap, values in percent
+//
+void print_heatmap(const std::string& title, const double* value)
+{
+    std::cout << "    " << title << '\n';
+    std::cout << "         ";
+    for(int c = 0; c < FIELD_COLS; ++c) std::cout << "     " << static_cast<char>('A' + c);
+    std::cout << '\n';
+    for(int r = 0; r < FIELD_ROWS; ++r)
+    {
+        std::cout << "      " << std::setw(2) << r + 1 << ' ';
+        for(int c = 0; c < FIELD_COLS; ++c) std::cout << std::setw(6) << 100. * value[cell_index(r, c)];
+        std::cout << '\n';
+    }
+    std::cout << '\n';
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_stats [-t threads] log [log ...]\n";
+    std::cout << "\n";
+    std::cout << "    -t threads   number of worker threads (default: all cores)\n";
+    std::cout << "    log          replay log written by battleship_game or battleship_sim -r\n";
+    std::cout << std::endl;
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int threads = 0;
+    std::vector<std::string> paths;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-t") && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if(argv[i][0] != '-')                       paths.push_back(argv[i]);
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if(paths.empty())
+    {
+        usage();
+        return 1;
+    }
+
+    // map the logs
+    std::vector<replay_reader> readers(paths.size());
+    std::vector<std::pair<std::size_t, std::size_t>> blocks; // (log, block)
+    std::size_t bytes = 0;
+    for(std::size_t l = 0; l < paths.size(); ++l)
+    {
+        if(!readers[l].Open(paths[l]))
+        {
+            std::cerr << "cannot open the replay log " << paths[l] << std::endl;
+            return 1;
+        }
+        for(std::size_t b = 0; b < readers[l].Blocks(); ++b) blocks.emplace_back(l, b);
+        bytes += readers[l].Bytes();
+    }
+
+    // scan the blocks in parallel
+    thread_pool pool(threads);
+    std::vector<statistics> st(pool.Size());
+    auto t0 = std::chrono::steady_clock::now();
+    pool.ParallelFor(blocks.size(), 1, [&](std::size_t begin, std::size_t end, int worker)
+    {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const replay_reader& r = readers[blocks[i].first];
+            scan_block(r.BlockBegin(blocks[i].second), r.BlockEnd(blocks[i].second), st[worker]);
+        }
+    });
+    auto t1 = std::chrono::steady_clock::now();
+
+    // merge the results
+    statistics tot;
+    for(const statistics& s : st) tot.Merge(s);
+    double seconds   = std::chrono::duration<double>(t1 - t0).count();
+    std::uint64_t completed = tot.games - tot.aborted;
+
+    // print the report
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "    logs            : " << paths.size() << '\n';
+    std::cout << "    threads         : " << pool.Size() << '\n';
+    std::cout << "    games           : " << tot.games << " (" << tot.aborted << " aborted)\n";
+    std::cout << "    elapsed         : " << seconds << " s\n";
+    std::cout << "    throughput      : " << tot.games / seconds << " games/s, " << bytes / seconds / 1e6 << " MB/s\n";
+    if(tot.games == 0)
+    {
+        std::cout << std::endl;
+        return 0;
+    }
+    if(completed > 0)
+    {
+        std::cout << "    shots to win    : mean " << hist_mean(tot.shots_to_win, win_bins)
+                  << ", p50 " << hist_percentile(tot.shots_to_win, win_bins, 0.50)
+                  << ", p90 " << hist_percentile(tot.shots_to_win, win_bins, 0.90)
+                  << ", p99 " << hist_percentile(tot.shots_to_win, win_bins, 0.99) << '\n';
+        std::cout << "    first side wins : " << 100. * tot.first_wins / completed << " %\n";
+    }
+    std::cout << "    first hit after : mean " << hist_mean(tot.first_hit, latency_bins)
+              << ", p50 " << hist_percentile(tot.first_hit, latency_bins, 0.50)
+              << ", p90 " << hist_percentile(tot.first_hit, latency_bins, 0.90)
+              << ", p99 " << hist_percentile(tot.first_hit, latency_bins, 0.99) << " misses\n";
+    std::cout << '\n';
+
+    // shot heatmaps
+    double shots[field_cells], hits[field_cells];
+    for(int c = 0; c < field_cells; ++c)
+    {
+        double miss = static_cast<double>(tot.shot[c]), hit = static_cast<double>(tot.shot[replay_hit_bit | c]);
+        shots[c] = (miss + hit) / (2. * tot.games);
+        hits[c]  = (miss + hit > 0) ? hit / (miss + hit) : 0.;
+    }
+    print_heatmap("shots per game and side (%)", shots);
+    print_heatmap("hit ratio (%)", hits);
+
+    // placement heatmaps: expand the placement counters to the cells
+    for(int s = carrier_idx; s <= fleet_ships; ++s)
+    {
+        const placement_view& table = placement_views[ship_size[s]];
+        double cover[field_cells] = {};
+        for(int p = 0; p < table.count; ++p)
+        {
+            bitboard cells = table.cells[p];
+            while(cells.Any()) cover[cells.PopLowest()] += static_cast<double>(tot.place[s][p]);
+        }
+        for(int c = 0; c < field_cells; ++c) cover[c] /= 2. * tot.games;
+        print_heatmap(ship_name[s] + " placement frequency (%)", cover);
+    }
+    std::cout << std::endl;
+    // program end
+    return 0;
+}
\ No newline at end of file
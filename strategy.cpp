@@ -0,0 +1,97 @@
+//==============================================================================
+//
+// strategy.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Strategy interface implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cstdlib>
+#include "strategy.hpp"
+
+// strategy functions
+//******************************************************************************
+int parse_strategy(const std::string& name) noexcept
+{
+    for(std::size_t i = 0; i < strategy_name.size(); ++i)
+    {
+        if(strategy_name[i] == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+any_strategy make_strategy(int idx)
+{
+    switch(idx)
+    {
+        case strategy_classic:
+        case strategy_density:
+        case strategy_montecarlo: return any_strategy::Make<computer>(idx);
+        case strategy_random:     return any_strategy::Make<random_strategy>();
+        case strategy_hunt:       return any_strategy::Make<hunt_strategy>();
+    }
+    return any_strategy();
+}
+
+//------------------------------------------------------------------------------
+bool parse_strategy_variant(const std::string& spec, const montecarlo_config& mc, strategy_variant& v) noexcept
+{
+    std::size_t sep = spec.find(':');
+    v.label    = spec;
+    v.strategy = parse_strategy(spec.substr(0, sep));
+    v.mc       = mc;
+    if(v.strategy < 0) return false;
+    if(sep == std::string::npos) return true;
+    if(v.strategy != strategy_montecarlo) return false;
+    long us = std::atol(spec.c_str() + sep + 1);
+    if(us <= 0) return false;
+    v.mc.budget = std::chrono::microseconds(us);
+    return true;
+}
+
+// Hunt strategy class implementation
+//******************************************************************************
+int hunt_strategy::FireCell() noexcept
+{
+    // neighbours of the hits of the ships afloat
+    bitboard open = Untargeted();
+    bitboard hits = _target_hit & ~_target_sunk;
+    bitboard near = ((hits << 1) & ~_first_col) | ((hits >> 1) & ~_last_col) | (hits << FIELD_COLS) | (hits >> FIELD_COLS);
+    near &= open;
+    if(near.None()) return RandomTarget();
+    return near.Select(static_cast<int>(_rng.Below(near.Count())));
+}
\ No newline at end of file
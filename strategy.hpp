@@ -0,0 +1,292 @@
+//==============================================================================
+//
+// strategy.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Strategy interface and strategy match header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __STRATEGY_HPP__
+#define __STRATEGY_HPP__
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "computer.hpp"
+#include "engine.hpp"
+
+// strategy indices (the computer targeting levels first)
+//------------------------------------------------------------------------------
+enum strategy_index
+{
+    strategy_classic    = ai_classic,
+    strategy_density    = ai_density,
+    strategy_montecarlo = ai_montecarlo,
+    strategy_random     = 3,
+    strategy_hunt       = 4
+};
+
+const std::vector<std::string> strategy_name = { "classic", "density", "montecarlo", "random", "hunt" };
+
+int parse_strategy(const std::string& name) noexcept; // -1 if unknown
+
+// strategy interface
+//******************************************************************************
+//
+// A strategy is a player (target grid and shot notifications) that provides
+//
+//   bool Place()    noexcept : fleet placement on its ocean grid
+//   int  FireCell() noexcept : next shot, cell index (-1 if no cell is left)
+//
+// Static dispatch: match<First, Second> calls the members of the concrete
+// types (qualified calls), so no virtual call is made per shot.
+// Runtime dispatch: any_strategy owns a strategy chosen at run time.
+//
+template<class S, class = void>
+struct is_strategy : std::false_type {};
+
+template<class S>
+struct is_strategy<S, std::void_t<decltype(std::declval<S&>().Place()), decltype(std::declval<S&>().FireCell())>>
+: std::bool_constant<std::is_base_of<player, S>::value> {};
+
+// random strategy class
+//------------------------------------------------------------------------------
+//
+// uniform shot among the cells not fired yet
+//
+class random_strategy final : public player
+{
+    public:
+        random_strategy() : player("Random") {}
+        bool inline Place()    noexcept { return InitRandom(); }
+        int  inline FireCell() noexcept { return RandomTarget(); }
+};
+
+// hunt strategy class
+//------------------------------------------------------------------------------
+//
+// shot next to a hit of a ship afloat, uniform shot otherwise
+//
+class hunt_strategy final : public player
+{
+    public:
+        hunt_strategy() : player("Hunt") {}
+        bool inline Place() noexcept { return InitRandom(); }
+        int         FireCell() noexcept;
+};
+
+static_assert(is_strategy<computer>::value,        "computer strategy");
+static_assert(is_strategy<random_strategy>::value, "random strategy");
+static_assert(is_strategy<hunt_strategy>::value,   "hunt strategy");
+
+// match class
+//------------------------------------------------------------------------------
+//
+// The engine rules on two concrete strategies: shots and notifications are
+// resolved at compile time.
+//
+template<class First, class Second>
+class match
+{
+    static_assert(is_strategy<First>::value && is_strategy<Second>::value, "match of two strategies");
+
+    public:
+        // initialization
+        match(First& first, Second& second) noexcept
+        : _first(first), _second(second), _turn(first_side), _winner(no_side), _shots{ 0, 0 }
+        {}
+
+        // game play: one shot of the side on turn
+        step_result Step(int cell) noexcept
+        {
+            if(End()) return step_result{ _turn, shot_invalid, -1, '\0', false, empty_idx };
+            step_result res = (_turn == first_side) ? play_shot(_first, _second, _turn, cell)
+                                                    : play_shot(_second, _first, _turn, cell);
+            if(res.outcome == shot_invalid) return res;
+            _shots[_turn]++;
+            if(res.end)
+            {
+                _winner = _turn;
+                return res;
+            }
+            _turn = 1 - _turn;
+            return res;
+        }
+
+        // game play: the side on turn chooses and plays its shot
+        step_result Play() noexcept
+        {
+            return Step((_turn == first_side) ? _first.First::FireCell() : _second.Second::FireCell());
+        }
+
+        // game play: plays up to the end of the game or max_shots shots
+        int Run(int max_shots) noexcept
+        {
+            for(int k = 0; k < max_shots && !End(); ++k) Play();
+            return _winner;
+        }
+
+        // get
+        int  inline Turn()    const noexcept { return _turn; }
+        int  inline Winner()  const noexcept { return _winner; }
+        bool inline End()     const noexcept { return _winner != no_side; }
+        int  inline GetShots(int side) const noexcept { return _shots[side]; }
+
+    private:
+        // instance variables
+        First&  _first;
+        Second& _second;
+        int     _turn;
+        int     _winner;
+        int     _shots[2];
+};
+
+// any strategy class
+//------------------------------------------------------------------------------
+//
+// Owns a strategy of any type (one virtual call per shot). The player stays at
+// the same address for the lifetime of the strategy, so it can be given to an
+// engine.
+//
+class any_strategy
+{
+    public:
+        // initialization
+        any_strategy() = default;
+        template<class S, class... Args>
+        static any_strategy Make(Args&&... args)
+        {
+            static_assert(is_strategy<S>::value, "any_strategy of a strategy");
+            any_strategy res;
+            res._self.reset(new model<S>(std::forward<Args>(args)...));
+            return res;
+        }
+        explicit operator bool() const noexcept { return static_cast<bool>(_self); }
+
+        // strategy
+        bool inline Place()    noexcept { return _self->Place(); }
+        int  inline FireCell() noexcept { return _self->FireCell(); }
+
+        // get
+        player&         Player()         noexcept { return _self->Player(); }
+        const player&   Player()   const noexcept { return _self->Player(); }
+        computer*       Computer()       noexcept { return _self->Computer(); } // nullptr if not a computer
+        const computer* Computer() const noexcept { return _self->Computer(); }
+
+    private:
+        struct concept_type
+        {
+            virtual ~concept_type() = default;
+            virtual bool      Place()    noexcept = 0;
+            virtual int       FireCell() noexcept = 0;
+            virtual player&   Player()   noexcept = 0;
+            virtual computer* Computer() noexcept = 0;
+        };
+
+        template<class S>
+        struct model final : concept_type
+        {
+            template<class... Args>
+            explicit model(Args&&... args) : strategy(std::forward<Args>(args)...) {}
+            bool      Place()    noexcept override { return strategy.S::Place(); }
+            int       FireCell() noexcept override { return strategy.S::FireCell(); }
+            player&   Player()   noexcept override { return strategy; }
+            computer* Computer() noexcept override
+            {
+                if constexpr(std::is_base_of<computer, S>::value) return &strategy;
+                else                                              return nullptr;
+            }
+            S strategy;
+        };
+
+        // instance variables
+        std::unique_ptr<concept_type> _self;
+};
+
+// strategy functions
+//------------------------------------------------------------------------------
+any_strategy make_strategy(int idx); // empty if idx is not a strategy_index
+
+//
+// calls f(s) on a strategy of type strategy_index 'idx' made on the stack (for
+// the static dispatch of a strategy chosen at run time); false if idx is not
+// a strategy_index
+//
+template<class F>
+bool with_strategy(int idx, F&& f)
+{
+    switch(idx)
+    {
+        case strategy_classic:
+        case strategy_density:
+        case strategy_montecarlo: { computer        s(idx); f(s); return true; }
+        case strategy_random:     { random_strategy s;      f(s); return true; }
+        case strategy_hunt:       { hunt_strategy   s;      f(s); return true; }
+    }
+    return false;
+}
+
+// strategy variant structure
+//------------------------------------------------------------------------------
+//
+// a strategy with its settings, "name" or "montecarlo:us" (montecarlo budget
+// per move in microseconds)
+//
+struct strategy_variant
+{
+    std::string       label;
+    int               strategy;
+    montecarlo_config mc;
+};
+
+bool parse_strategy_variant(const std::string& spec, const montecarlo_config& mc, strategy_variant& v) noexcept;
+
+//
+// with_strategy on the variant strategy, configured with the variant settings
+//
+template<class F>
+bool with_variant(const strategy_variant& v, F&& f)
+{
+    return with_strategy(v.strategy, [&v, &f](auto& s)
+    {
+        if constexpr(std::is_base_of<computer, std::decay_t<decltype(s)>>::value) s.SetMonteCarlo(v.mc);
+        f(s);
+    });
+}
+
+#endif /* __STRATEGY_HPP__ */
\ No newline at end of file
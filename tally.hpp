@@ -0,0 +1,108 @@
+//==============================================================================
+//
+// tally.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Self-play game guard and per-worker results header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __TALLY_HPP__
+#define __TALLY_HPP__
+
+#include <cstddef>
+#include <vector>
+#include "engine.hpp"
+
+// game guard
+//------------------------------------------------------------------------------
+//
+// shots of both sides after which a game on a board of 'cells' cells is
+// aborted: each side fires every cell at most once, so only a strategy that
+// repeats its shots gets there
+//
+int inline max_game_shots(int cells) noexcept { return 4 * cells; }
+
+// game tally structure
+//------------------------------------------------------------------------------
+//
+// per-worker results of the self-play tools (cache line aligned, so that the
+// workers do not share lines), merged at the end of the run. shots_to_win is
+// the histogram of the winner shots; score and played are the n x n matrices
+// of a tournament, row entrant against column entrant.
+//
+struct alignas(64) game_tally
+{
+    long                games       = 0;
+    long                aborted     = 0;
+    long                first_wins  = 0;
+    long                total_shots = 0;
+    std::vector<long>   shots_to_win;
+    std::vector<double> score;
+    std::vector<long>   played;
+
+    explicit game_tally(std::size_t cells = 0, std::size_t entrants = 0)
+    : shots_to_win(cells + 1, 0), score(entrants * entrants, 0.), played(entrants * entrants, 0)
+    {}
+
+    // finished or aborted game
+    template<class Engine>
+    void Collect(const Engine& game)
+    {
+        games++;
+        if(!game.End())
+        {
+            aborted++;
+            return;
+        }
+        int shots = game.GetShots(game.Winner());
+        if(game.Winner() == first_side) first_wins++;
+        total_shots += shots;
+        shots_to_win[shots]++;
+    }
+
+    void Merge(const game_tally& t)
+    {
+        games       += t.games;
+        aborted     += t.aborted;
+        first_wins  += t.first_wins;
+        total_shots += t.total_shots;
+        for(std::size_t i = 0; i < shots_to_win.size(); ++i) shots_to_win[i] += t.shots_to_win[i];
+        for(std::size_t i = 0; i < score.size(); ++i)        score[i]        += t.score[i];
+        for(std::size_t i = 0; i < played.size(); ++i)       played[i]       += t.played[i];
+    }
+};
+
+#endif /* __TALLY_HPP__ */
\ No newline at end of file
@@ -0,0 +1,501 @@
+//==============================================================================
+//
+// tests.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Engine, snapshot and protocol checks (ctest)
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "battleship.hpp"
+#include "montecarlo.hpp"
+#include "random.hpp"
+#include "replay.hpp"
+#include "session.hpp"
+#include "snapshot.hpp"
+#include "sparse.hpp"
+#include "strategy.hpp"
+#include "thread_pool.hpp"
+
+// test functions
+//******************************************************************************
+int failures = 0;
+
+void check(bool condition, const std::string& what)
+{
+    if(condition) return;
+    std::cerr << "FAILED: " << what << std::endl;
+    failures++;
+}
+
+//------------------------------------------------------------------------------
+bool same_snapshot(const game_snapshot& a, const game_snapshot& b)
+{
+    return std::memcmp(&a, &b, sizeof(game_snapshot)) == 0;
+}
+
+//------------------------------------------------------------------------------
+//
+// snapshot of a game in progress: the file round trip and the restored game
+// give back the same image, the restored game goes on as the original one,
+// and the images that do not describe a game are refused
+//
+void test_snapshot()
+{
+    const std::string path = "battleship_tests.snap";
+    std::istringstream in;
+    std::ostringstream out_a, out_b;
+    battleship a(in, out_a), b(in, out_b);
+    a.Start();
+    a.Feed("a");
+    for(const char* shot : { "a1", "b2", "c3", "d4", "e5" }) a.Feed(shot);
+    game_snapshot saved{}, loaded{}, restored{};
+    a.Save(saved);
+    check(check_snapshot(saved), "snapshot of a game in progress is valid");
+    check(save_snapshot(path, saved), "snapshot saved");
+    check(load_snapshot(path, loaded) && same_snapshot(saved, loaded), "snapshot file round trip");
+    b.Start();
+    b.Feed("a");
+    b.Restore(loaded);
+    b.Save(restored);
+    check(same_snapshot(saved, restored), "restored game image");
+    // same shots, same random streams: the two games stay equal
+    for(const char* shot : { "f6", "g7", "h8", "i9", "j10" })
+    {
+        a.Feed(shot);
+        b.Feed(shot);
+    }
+    a.Save(saved);
+    b.Save(restored);
+    check(same_snapshot(saved, restored), "restored game goes on as the original");
+
+    // non-valid images
+    game_snapshot bad = saved;
+    bad.size--;
+    check(!check_snapshot(bad), "snapshot size refused");
+    bad = saved;
+    bad.engine.turn = 2;
+    check(!check_snapshot(bad), "turn out of range refused");
+    bad = saved;
+    bad.engine.winner = 2;
+    check(!check_snapshot(bad), "winner out of range refused");
+    bad = saved;
+    bad.user.target_hit.Set(field_cells + 3);
+    check(!check_snapshot(bad), "shot outside the field refused");
+    bad = saved;
+    bad.computer.ship_mask[submarine_idx] = bad.computer.ship_mask[cruiser_idx];
+    check(!check_snapshot(bad), "overlapping ships refused");
+    bad = saved;
+    bad.ai.level = static_cast<std::int32_t>(strategy_name.size());
+    check(!check_snapshot(bad), "strategy out of range refused");
+    check(save_snapshot(path, bad) && !load_snapshot(path, loaded), "non-valid snapshot file refused");
+    std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+//
+// random games appended to a replay log
+//
+void append_games(replay_writer& log, std::uint64_t seed, int games)
+{
+    replay_game replay;
+    for(int g = 0; g < games; ++g)
+    {
+        rng             game_rng = rng::Stream(seed, static_cast<std::uint64_t>(g));
+        random_strategy first, second;
+        first.Seed(game_rng.Next());
+        second.Seed(game_rng.Next());
+        first.Place();
+        second.Place();
+        match<random_strategy, random_strategy> game(first, second);
+        replay.Start(seed + g, first, second);
+        while(!game.End()) replay.Add(game.Play());
+        log.Append(replay);
+    }
+}
+
+//------------------------------------------------------------------------------
+int count_games(const std::string& path, std::size_t& blocks)
+{
+    replay_reader reader;
+    blocks = 0;
+    if(!reader.Open(path)) return -1;
+    int games = 0;
+    for(const replay_record& rec : reader)
+    {
+        if(rec.winner == first_side || rec.winner == second_side) games++;
+    }
+    blocks = reader.Blocks();
+    return games;
+}
+
+//------------------------------------------------------------------------------
+//
+// replay log resumed after a close, after a record cut by a crash and
+// without its index
+//
+void test_replay()
+{
+    const std::string path = "battleship_tests.rlog", index = path + ".idx";
+    const int first_run = static_cast<int>(replay_stride) + 100, second_run = 3000;
+    std::remove(path.c_str());
+    std::remove(index.c_str());
+    std::size_t blocks;
+    {
+        replay_writer log;
+        check(log.Open(path), "replay log created");
+        append_games(log, 1, first_run);
+        check(log.Close(), "replay log closed");
+    }
+    {
+        replay_writer log;
+        check(log.Open(path) && log.Games() == static_cast<std::uint64_t>(first_run), "replay log resumed");
+        append_games(log, 2, second_run);
+        log.Close();
+    }
+    check(count_games(path, blocks) == first_run + second_run && blocks == 2, "replay log read back");
+    // the last record cut by a crash is dropped
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 5);
+    {
+        replay_writer log;
+        check(log.Open(path) && log.Games() == static_cast<std::uint64_t>(first_run + second_run - 1), "cut record dropped");
+    }
+    // the index is rebuilt from the log
+    std::remove(index.c_str());
+    {
+        replay_writer log;
+        check(log.Open(path) && log.Games() == static_cast<std::uint64_t>(first_run + second_run - 1), "replay log resumed without index");
+    }
+    check(count_games(path, blocks) == first_run + second_run - 1 && blocks == 2, "replay index rebuilt");
+    std::remove(path.c_str());
+    std::remove(index.c_str());
+}
+
+//------------------------------------------------------------------------------
+//
+// per-ship health: a ship is reported sunk by the shot on its last cell, also
+// when its hits were restored from a snapshot, and the last ship ends the game
+//
+void test_ships()
+{
+    random_strategy shooter, target;
+    // the fleet on the first rows, from the first column heading right
+    bool placed = true;
+    for(int s = carrier_idx; s <= destroier_idx; ++s) placed = target.InitShip(s, cell_index(s - carrier_idx, 0), dir_right) && placed;
+    check(placed, "fleet placed");
+    step_result res;
+    for(int k = 0; k < ship_size[carrier_idx]; ++k)
+    {
+        res = play_shot(shooter, target, first_side, cell_index(0, k));
+        check(res.outcome == shot_hit && res.sunk == ((k + 1 < ship_size[carrier_idx]) ? empty_idx : carrier_idx), "carrier sunk by its last cell");
+    }
+    check(shooter.IsSunk(carrier_idx) && !shooter.IsSunk(battleship_idx), "carrier sunk reported to the shooter");
+    // the hits survive a snapshot of the target
+    play_shot(shooter, target, first_side, cell_index(1, 0));
+    play_shot(shooter, target, first_side, cell_index(1, 1));
+    player_state state;
+    target.GetState(state);
+    random_strategy restored;
+    restored.SetState(state);
+    res = play_shot(shooter, restored, first_side, cell_index(1, 2));
+    check(res.sunk == empty_idx, "restored battleship afloat");
+    res = play_shot(shooter, restored, first_side, cell_index(1, 3));
+    check(res.sunk == battleship_idx && !res.end, "restored battleship sunk");
+    // the last ship ends the game
+    for(int s = cruiser_idx; s <= destroier_idx; ++s)
+    {
+        for(int k = 0; k < ship_size[s]; ++k) res = play_shot(shooter, restored, first_side, cell_index(s - carrier_idx, k));
+        check(res.sunk == s, "ship sunk");
+    }
+    check(res.end && shooter.End(), "game over once the fleet is sunk");
+}
+
+//------------------------------------------------------------------------------
+//
+// sunk ship inference on an unknown fleet: the only placement through the
+// shot on the open hits
+//
+void test_sunk_cells()
+{
+    bitboard open, cells, expected;
+    for(int c = 0; c < 5; ++c) open.Set(cell_index(0, c));
+    expected = open;
+    check(sunk_cells(open, carrier_idx, cell_index(0, 4), cells) && cells == expected, "carrier inferred");
+    check(!sunk_cells(open, carrier_idx, cell_index(3, 3), cells), "shot off the hits not inferred");
+    // a sixth hit in line: two placements through the shot
+    open.Set(cell_index(0, 5));
+    check(!sunk_cells(open, carrier_idx, cell_index(0, 4), cells), "ambiguous carrier not inferred");
+    // the end of the line admits one placement only
+    expected.Clear(cell_index(0, 0));
+    expected.Set(cell_index(0, 5));
+    check(sunk_cells(open, carrier_idx, cell_index(0, 5), cells) && cells == expected, "carrier at the end of the line inferred");
+    // vertical destroier next to a horizontal hit
+    open = bitboard();
+    open.Set(cell_index(8, 9));
+    open.Set(cell_index(9, 9));
+    open.Set(cell_index(9, 7));
+    expected = bitboard();
+    expected.Set(cell_index(8, 9));
+    expected.Set(cell_index(9, 9));
+    check(sunk_cells(open, destroier_idx, cell_index(9, 9), cells) && cells == expected, "vertical destroier inferred");
+    open.Set(cell_index(9, 8));
+    check(!sunk_cells(open, destroier_idx, cell_index(9, 9), cells), "ambiguous destroier not inferred");
+}
+
+//------------------------------------------------------------------------------
+std::string reply(session& s, const std::string& line)
+{
+    std::string out;
+    s.Handle(line, out);
+    return out;
+}
+
+//------------------------------------------------------------------------------
+bool starts_with(const std::string& text, const std::string& prefix)
+{
+    return text.compare(0, prefix.size(), prefix) == 0;
+}
+
+//------------------------------------------------------------------------------
+//
+// protocol transcripts: the replies of a session with a known fleet, the
+// errors that leave the session unchanged, and a whole game with an external
+// fleet answered by the client
+//
+void test_protocol()
+{
+    session s(1);
+    check(reply(s, "") == "", "empty line not answered");
+    check(reply(s, "fire a1") == "error fire state\n", "fire before new");
+    check(reply(s, "board") == "error board state\n", "board before new");
+    check(reply(s, "new 5 classic") == "ok new 5 classic\n", "new");
+    check(reply(s, "new 5 nosuchstrategy") == "error new strategy\n", "new with an unknown strategy");
+    check(reply(s, "fire a1") == "error fire state\n", "fire before place");
+    check(reply(s, "place a1r a2r a3r a4r") == "error place fleet\n", "place with a missing ship");
+    check(reply(s, "place a1r a1d a3r a4r a5r") == "error place fleet\n", "place with overlapping ships");
+    check(starts_with(reply(s, "place a1r a2r a3r a4r a5r"), "ok place ccccc-----bbbb------rrr"), "place");
+    check(reply(s, "place") == "error place state\n", "place twice");
+    check(reply(s, "fire z9") == "error fire cell\n", "fire outside the field");
+    check(starts_with(reply(s, "fire a1"), "ok fire a1 "), "fire");
+    check(reply(s, "result hit") == "error result state\n", "result without an external fleet");
+    check(reply(s, "bogus") == "error bogus unknown\n", "unknown command");
+    check(reply(s, "board").size() == std::string("ok board ").size() + 2 * field_cells + 2, "board");
+    // a whole game: the remote fires every cell in order
+    std::string out;
+    for(int cell = 0; cell < field_cells && s.State() == session_playing; ++cell) out = reply(s, "fire " + cell_position(cell));
+    check(s.State() == session_over && out.find(" win ") != std::string::npos, "game over");
+    check(reply(s, "fire j10") == "error fire state\n", "fire after the game");
+    std::string quit;
+    check(!s.Handle("quit", quit) && quit == "ok quit\n" && s.Closed(), "quit");
+    check(!s.Handle("new", quit), "no commands after quit");
+
+    // external fleet: the client answers the computer shots
+    session e(2);
+    random_strategy client;
+    client.Seed(7);
+    client.Place();
+    reply(e, "new 9 density");
+    check(reply(e, "place external") == "ok place external\n", "place external");
+    check(reply(e, "result miss") == "error result state\n", "result before a computer shot");
+    int sunk = 0;
+    for(int cell = 0; cell < field_cells && e.State() == session_playing; ++cell)
+    {
+        out = reply(e, "fire " + cell_position(cell));
+        std::size_t at = out.find(" shot ");
+        if(at == std::string::npos) break;
+        std::string pos = out.substr(at + 6, out.size() - at - 7);
+        check(reply(e, "fire " + cell_position(cell)) == "error fire state\n", "fire before the result");
+        check(reply(e, "result sunk nosuchship") == "error result outcome\n", "result of an unknown ship");
+        shot_report rep = client.CheckShot(client.Cell(pos));
+        std::string outcome = (rep.result == miss_idx) ? "miss" : (rep.result == hit_idx) ? "hit" : "sunk ";
+        if(rep.result == sunk_idx)
+        {
+            for(char c : ship_name[rep.ship]) outcome += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            sunk++;
+        }
+        out = reply(e, "result " + outcome);
+        check(starts_with(out, "ok result"), "result");
+    }
+    check(e.State() == session_over && out.find(" win ") != std::string::npos, "external game over");
+    check(sunk <= destroier_idx && (sunk < destroier_idx || out == "ok result win computer\n"), "external game won by the sunk fleet");
+}
+
+//------------------------------------------------------------------------------
+//
+// replay log scanned without its index: the reader splits the records in
+// blocks of replay_stride games, as the index does
+//
+void test_replay_blocks()
+{
+    const std::string path = "battleship_tests_blocks.rlog", index = path + ".idx";
+    const int games = 2 * static_cast<int>(replay_stride) + 500;
+    std::remove(path.c_str());
+    std::remove(index.c_str());
+    {
+        replay_writer log;
+        check(log.Open(path), "replay log created");
+        append_games(log, 3, games);
+        log.Close();
+    }
+    std::remove(index.c_str());
+    replay_reader reader;
+    check(reader.Open(path), "replay log opened without index");
+    check(reader.Blocks() == 3, "replay log split without index");
+    int scanned = 0;
+    for(std::size_t b = 0; b < reader.Blocks(); ++b)
+    {
+        int block = 0;
+        for(auto it = reader.BlockBegin(b); it != reader.BlockEnd(b); ++it) block++;
+        check(block <= static_cast<int>(replay_stride), "block of replay_stride games at most");
+        scanned += block;
+    }
+    check(scanned == games, "every game scanned once");
+    reader.Close();
+    std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+//
+// montecarlo sampling on a pool: the samples cap is shared by the pool, the
+// moves of the workers of another pool wait for their own shares only, and a
+// worker of the sampling pool samples on its own instead of waiting for it
+//
+void test_montecarlo()
+{
+    static const int sizes[] = { 5, 4, 3, 3, 2 };
+    bitboard miss, hit;
+    for(int c = 0; c < FIELD_COLS; c += 2) miss.Set(cell_index(4, c));
+    hit.Set(cell_index(2, 3));
+    thread_pool sampling(3), games(2);
+    montecarlo_config mc;
+    mc.budget      = std::chrono::seconds(10);
+    mc.max_samples = 3000;
+    mc.pool        = &sampling;
+    rng  gen(1);
+    long samples = 0;
+    int  cell    = montecarlo_target(miss, hit, sizes, 5, mc, gen, &samples);
+    check(cell >= 0 && cell < field_cells && !miss.Test(cell) && !hit.Test(cell), "montecarlo shot on a free cell");
+    check(samples >= mc.max_samples, "montecarlo samples cap shared by the pool");
+    // concurrent moves from the workers of another pool
+    long moves[2] = { 0, 0 };
+    games.ParallelFor(8, 1, [&](std::size_t begin, std::size_t, int worker)
+    {
+        rng  move_gen(begin + 2);
+        long n = 0;
+        if(montecarlo_target(miss, hit, sizes, 5, mc, move_gen, &n) >= 0 && n >= mc.max_samples) moves[worker]++;
+    });
+    check(moves[0] + moves[1] == 8, "montecarlo moves from another pool");
+    // moves from the workers of the sampling pool itself
+    long serial[3] = { 0, 0, 0 };
+    sampling.ParallelFor(6, 1, [&](std::size_t begin, std::size_t, int worker)
+    {
+        rng  move_gen(begin + 20);
+        long n = 0;
+        if(montecarlo_target(miss, hit, sizes, 5, mc, move_gen, &n) >= 0 && n >= mc.max_samples / 3) serial[worker]++;
+    });
+    check(serial[0] + serial[1] + serial[2] == 6, "montecarlo moves from the sampling pool");
+}
+
+//------------------------------------------------------------------------------
+//
+// basic engine shots: a 64-bit cell outside the board is refused before it is
+// narrowed to the board cell type, and does not consume the turn
+//
+template<class Board>
+void check_engine_cells(Board& first, Board& second, const std::string& name)
+{
+    basic_engine<Board> game(first, second);
+    for(std::int64_t cell : { -1LL, static_cast<long long>(first.Cells()), (1LL << 32) + 5, (1LL << 62) })
+    {
+        step_result res = game.Step(cell);
+        check(res.outcome == shot_invalid && game.Turn() == first_side && game.GetShots(first_side) == 0, name + " cell outside the board refused");
+    }
+    step_result res = game.Step(5);
+    check(res.outcome != shot_invalid && res.cell == 5 && game.GetShots(first_side) == 1, name + " cell in the board played");
+}
+
+void test_engine()
+{
+    basic_player<8, 8, small_fleet> first, second;
+    first.Seed(1);
+    second.Seed(2);
+    first.InitRandom();
+    second.InitRandom();
+    check_engine_cells(first, second, "basic_player");
+    sparse_player sparse_first(100, 100, { 5, 4, 3 }), sparse_second(100, 100, { 5, 4, 3 });
+    sparse_first.InitRandom();
+    sparse_second.InitRandom();
+    check_engine_cells(sparse_first, sparse_second, "sparse_player");
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    struct test { const char* name; void (*run)(); };
+    const test tests[] = {
+        { "snapshot", test_snapshot },
+        { "replay",   test_replay   },
+        { "blocks",   test_replay_blocks },
+        { "ships",    test_ships    },
+        { "sunk",     test_sunk_cells },
+        { "protocol", test_protocol },
+        { "montecarlo", test_montecarlo },
+        { "engine",   test_engine   },
+    };
+    // run the given test, all of them without arguments
+    bool found = false;
+    for(const test& t : tests)
+    {
+        if(argc > 1 && std::strcmp(argv[1], t.name) != 0) continue;
+        found = true;
+        t.run();
+    }
+    if(!found)
+    {
+        std::cerr << "usage: battleship_tests [test]" << std::endl;
+        return 2;
+    }
+    // program end
+    return (failures == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+//==============================================================================
+//
+// thread_pool.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ implementation
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Work-stealing thread pool implementation
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include "thread_pool.hpp"
+#include <algorithm>
+
+// worker identification
+//------------------------------------------------------------------------------
+static thread_local const thread_pool* tl_pool   = nullptr;
+static thread_local int                tl_worker = -1;
+
+// Thread pool class implementation
+//******************************************************************************
+// initialization
+//------------------------------------------------------------------------------
+thread_pool::thread_pool(int threads)
+: _pending(0), _queued(0), _next(0), _stop(false)
+{
+    // select the number of workers
+    if(threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+    if(threads <= 0) threads = 1;
+    // make the queues before starting any worker
+    for(int i = 0; i < threads; ++i) _queues.emplace_back(new worker_queue);
+    // start the workers
+    for(int i = 0; i < threads; ++i) _threads.emplace_back(&thread_pool::_Run, this, i);
+}
+
+//------------------------------------------------------------------------------
+thread_pool::~thread_pool()
+{
+    // stop the workers
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+    _wake.notify_all();
+    // join the threads
+    for(std::thread& th : _threads) th.join();
+}
+
+// get
+//------------------------------------------------------------------------------
+bool thread_pool::InWorker() const noexcept
+{
+    return tl_pool == this;
+}
+
+// task management
+//------------------------------------------------------------------------------
+void thread_pool::Submit(task t)
+{
+    // select the target queue: the own queue from a worker, round robin otherwise
+    int id = (tl_pool == this) ? tl_worker : static_cast<int>(_next++ % _queues.size());
+    _pending++;
+    {
+        std::lock_guard<std::mutex> guard(_queues[id]->lock);
+        _queues[id]->tasks.push_back(std::move(t));
+    }
+    // wake up a worker: the count is raised under the lock of the waits, so
+    // a worker between its last pop and its wait cannot miss the task
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queued++;
+    }
+    _wake.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void thread_pool::ParallelFor(std::size_t n, std::size_t chunk,
+                              const std::function<void(std::size_t begin, std::size_t end, int worker)>& body)
+{
+    if(chunk == 0) chunk = 1;
+    // split the range
+    for(std::size_t begin = 0; begin < n; begin += chunk)
+    {
+        std::size_t end = std::min(n, begin + chunk);
+        Submit([&body, begin, end](int worker) { body(begin, end, worker); });
+    }
+    // wait for the chunks
+    Wait();
+}
+
+//------------------------------------------------------------------------------
+void thread_pool::Wait()
+{
+    std::unique_lock<std::mutex> guard(_lock);
+    _idle.wait(guard, [this] { return _pending.load() == 0; });
+}
+
+// auxiliary methods
+//------------------------------------------------------------------------------
+void thread_pool::_Run(int id)
+{
+    tl_pool   = this;
+    tl_worker = id;
+    task t;
+    while(true)
+    {
+        // run the local or a stolen task
+        if(_Pop(id, t) || _Steal(id, t))
+        {
+            t(id);
+            t = nullptr;
+            // notify the end of the last task
+            if(--_pending == 0)
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _idle.notify_all();
+            }
+            continue;
+        }
+        // wait for new tasks
+        std::unique_lock<std::mutex> guard(_lock);
+        _wake.wait(guard, [this] { return _stop || _queued.load() > 0; });
+        if(_stop) return;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool thread_pool::_Pop(int id, task& t)
+{
+    worker_queue& q = *_queues[id];
+    std::lock_guard<std::mutex> guard(q.lock);
+    if(q.tasks.empty()) return false;
+    // take the newest task
+    t = std::move(q.tasks.back());
+    q.tasks.pop_back();
+    _queued--;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool thread_pool::_Steal(int id, task& t)
+{
+    int n = static_cast<int>(_queues.size());
+    for(int k = 1; k < n; ++k)
+    {
+        worker_queue& q = *_queues[(id + k) % n];
+        std::lock_guard<std::mutex> guard(q.lock);
+        if(q.tasks.empty()) continue;
+        // take the oldest task
+        t = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        _queued--;
+        return true;
+    }
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+//==============================================================================
+//
+// thread_pool.hpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ header
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Work-stealing thread pool header
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// thread pool class
+//------------------------------------------------------------------------------
+//
+// Work-stealing pool: every worker owns a task deque. Tasks submitted from a
+// worker go to its own deque (LIFO end), the other tasks are dealt round robin.
+// An idle worker pops its own deque first, then steals from the FIFO end of
+// the other deques. Each task receives the index of the worker running it, so
+// that callers can keep per-worker accumulators without locking.
+//
+class thread_pool
+{
+    public:
+        typedef std::function<void(int worker)> task;
+
+        // initialization
+        explicit thread_pool(int threads = 0); // 0 = hardware concurrency
+        ~thread_pool();
+
+        thread_pool(const thread_pool&)            = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        // get
+        int inline Size() const noexcept { return static_cast<int>(_threads.size()); }
+        bool InWorker() const noexcept; // true on a worker thread of this pool
+
+        // task management
+        void Submit(task t);
+        void ParallelFor(std::size_t n, std::size_t chunk,
+                         const std::function<void(std::size_t begin, std::size_t end, int worker)>& body);
+        void Wait();
+
+    private:
+        // worker queue structure
+        struct worker_queue
+        {
+            std::mutex       lock;
+            std::deque<task> tasks;
+        };
+
+        // auxiliary methods
+        void _Run(int id);
+        bool _Pop(int id, task& t);
+        bool _Steal(int id, task& t);
+
+        // instance variables
+        std::vector<std::unique_ptr<worker_queue>> _queues;
+        std::vector<std::thread>                   _threads;
+        std::mutex                                 _lock;
+        std::condition_variable                    _wake;
+        std::condition_variable                    _idle;
+        std::atomic<long>                          _pending; // submitted, not finished
+        std::atomic<long>                          _queued;  // submitted, not taken (raised under _lock)
+        std::atomic<unsigned>                      _next;
+        bool                                       _stop;
+};
+
+#endif /* __THREAD_POOL_HPP__ */
\ No newline at end of file
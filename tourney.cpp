@@ -0,0 +1,340 @@
+//==============================================================================
+//
+// tourney.cpp
+//
+// version   : 1.0
+// topic     : battleship game
+// class     : C++ main
+// author    : Marco Bontempi
+// created   : 17-Oct-2026
+//
+// abstract:
+//  Parallel round-robin strategy tournament with Elo ratings
+//
+//------------------------------------------------------------------------------
+// 2021-2024 by Marco Bontempi <marco.bontempi@gmail.com>.
+//
+// Redistribution  and   use  in   source  and  binary  forms,  with  or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source  code  must  retain the  above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form  must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in  the documentation
+//    and/or other materials provided with the distribution.
+// 3. Redistribution in any form  must include the references associated to this
+//    code  in  the  documentation  and/or  other materials  provided  with  the
+//    distribution.
+//
+// THIS SOFTWARE  IS PROVIDED BY THE AUTHOR AND  CONTRIBUTORS ``AS IS''  AND ANY
+// EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT  NOT  LIMITED TO, THE IMPLIED
+// WARRANTIES  OF  MERCHANTABILITY AND  FITNESS  FOR  A  PARTICULAR PURPOSE  ARE
+// DISCLAIMED. IN NO  EVENT  SHALL THE AUTHOR OR CONTRIBUTORS  BE LIABLE FOR ANY
+// DIRECT,  INDIRECT,  INCIDENTAL, SPECIAL,  EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING,  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION)  HOWEVER CAUSED AND
+// ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY,  OR  TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "computer.hpp"
+#include "engine.hpp"
+#include "strategy.hpp"
+#include "tally.hpp"
+#include "thread_pool.hpp"
+
+// rating structure
+//------------------------------------------------------------------------------
+struct rating
+{
+    double elo;  // relative to the field mean
+    double ci95; // half width of the 95 % confidence interval
+};
+
+// tournament functions
+//******************************************************************************
+bool parse_entrants(const std::string& list, const montecarlo_config& mc, std::vector<strategy_variant>& entrants)
+{
+    std::stringstream ss(list);
+    std::string       spec;
+    while(std::getline(ss, spec, ','))
+    {
+        strategy_variant e;
+        if(!parse_strategy_variant(spec, mc, e)) return false;
+        entrants.push_back(e);
+    }
+    return entrants.size() >= 2;
+}
+
+//------------------------------------------------------------------------------
+//
+// game of 'a' against 'b' (static dispatch) on the game seed: each entrant gets
+// the same placement and shot seeds whatever its seat, so the swapped game
+// replays the same fleets with the other side first.
+// 1 if a wins, -1 if b wins, 0 if aborted
+//
+template<class A, class B>
+int play_pairing(A& a, B& b, std::uint64_t game_seed, bool swapped)
+{
+    rng game_rng(game_seed);
+    a.Seed(game_rng.Next());
+    b.Seed(game_rng.Next());
+    a.A::Place();
+    b.B::Place();
+    if(!swapped)
+    {
+        match<A, B> game(a, b);
+        game.Run(max_game_shots(field_cells));
+        if(!game.End()) return 0;
+        return (game.Winner() == first_side) ? 1 : -1;
+    }
+    match<B, A> game(b, a);
+    game.Run(max_game_shots(field_cells));
+    if(!game.End()) return 0;
+    return (game.Winner() == first_side) ? -1 : 1;
+}
+
+//------------------------------------------------------------------------------
+int play_game(const strategy_variant& ea, const strategy_variant& eb, std::uint64_t game_seed, bool swapped)
+{
+    int res = 0;
+    with_variant(ea, [&](auto& a)
+    {
+        with_variant(eb, [&](auto& b)
+        {
+            res = play_pairing(a, b, game_seed, swapped);
+        });
+    });
+    return res;
+}
+
+//------------------------------------------------------------------------------
+//
+// Bradley-Terry maximum likelihood ratings (minorization-maximization
+// iterations) of the n x n score and games matrices, on the Elo scale. Each
+// pairing gets one virtual draw, so that an entrant without wins or losses
+// keeps a finite rating. The confidence interval is the normal approximation
+// of the diagonal of the information matrix.
+//
+std::vector<rating> fit_ratings(const std::vector<double>& score, const std::vector<long>& games, std::size_t n)
+{
+    std::vector<double> wins(n, 0.), gamma(n, 1.), next(n);
+    std::vector<double> played(n * n, 0.);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            if(i == j) continue;
+            played[i * n + j] = games[i * n + j] + 1.;
+            wins[i]          += score[i * n + j] + 0.5;
+        }
+    }
+    for(int iter = 0; iter < 10000; ++iter)
+    {
+        double delta = 0.;
+        double log_mean = 0.;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            double den = 0.;
+            for(std::size_t j = 0; j < n; ++j)
+            {
+                if(i != j) den += played[i * n + j] / (gamma[i] + gamma[j]);
+            }
+            next[i]   = wins[i] / den;
+            log_mean += std::log(next[i]);
+        }
+        log_mean /= n;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            next[i] /= std::exp(log_mean);
+            delta    = std::max(delta, std::fabs(std::log(next[i] / gamma[i])));
+        }
+        gamma.swap(next);
+        if(delta < 1e-10) break;
+    }
+    // Elo scale: 400 points for a 10:1 odds ratio
+    const double scale = 400. / std::log(10.);
+    std::vector<rating> res(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        double info = 0.;
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            if(i == j) continue;
+            double p = gamma[i] / (gamma[i] + gamma[j]);
+            info    += played[i * n + j] * p * (1. - p);
+        }
+        res[i].elo  = scale * std::log(gamma[i]);
+        res[i].ci95 = 1.96 * scale / std::sqrt(info);
+    }
+    return res;
+}
+
+//------------------------------------------------------------------------------
+void usage()
+{
+    std::cout << "usage: battleship_tourney [-p entrants] [-n games] [-t threads] [-c chunk] [-s seed] [-m us] [-M samples]\n";
+    std::cout << "\n";
+    std::cout << "    -p entrants  comma separated strategies, montecarlo:us for a budget variant\n";
+    std::cout << "                 (default: all the strategies)\n";
+    std::cout << "    -n games     games per pairing, seats swapped on every other game (default 1000)\n";
+    std::cout << "    -t threads   number of worker threads (default: all cores)\n";
+    std::cout << "    -c chunk     games per scheduled task (default 16)\n";
+    std::cout << "    -s seed      master seed, game i of every pairing is played on stream i/2 (default: random)\n";
+    std::cout << "    -m us        montecarlo budget per move in microseconds (default 1000)\n";
+    std::cout << "    -M samples   montecarlo samples cap per move (default: budget only)\n";
+    std::cout << "\n";
+    std::cout << "    strategies   :";
+    for(const std::string& name : strategy_name) std::cout << ' ' << name;
+    std::cout << '\n';
+    std::cout << std::endl;
+}
+
+// main program
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    long games   = 1000;
+    int  threads = 0;
+    long chunk   = 16;
+    std::uint64_t seed = thread_rng().Next();
+    std::string list;
+    montecarlo_config mc;
+    // parse the arguments
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!std::strcmp(argv[i], "-p") && i + 1 < argc)      list    = argv[++i];
+        else if(!std::strcmp(argv[i], "-n") && i + 1 < argc) games   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-t") && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "-c") && i + 1 < argc) chunk   = std::atol(argv[++i]);
+        else if(!std::strcmp(argv[i], "-s") && i + 1 < argc) seed    = std::strtoull(argv[++i], nullptr, 10);
+        else if(!std::strcmp(argv[i], "-m") && i + 1 < argc) mc.budget      = std::chrono::microseconds(std::atol(argv[++i]));
+        else if(!std::strcmp(argv[i], "-M") && i + 1 < argc) mc.max_samples = std::atol(argv[++i]);
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if(list.empty())
+    {
+        for(const std::string& name : strategy_name) list += (list.empty() ? "" : ",") + name;
+    }
+    std::vector<strategy_variant> entrants;
+    if(!parse_entrants(list, mc, entrants) || games <= 0 || chunk <= 0)
+    {
+        usage();
+        return 1;
+    }
+
+    // make the pairings
+    std::size_t n = entrants.size();
+    std::vector<std::pair<std::size_t, std::size_t>> pairings;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        for(std::size_t j = i + 1; j < n; ++j) pairings.emplace_back(i, j);
+    }
+
+    // run the tournament
+    thread_pool pool(threads);
+    std::vector<game_tally> acc(pool.Size(), game_tally(0, n));
+    std::size_t total = pairings.size() * games;
+    auto t0 = std::chrono::steady_clock::now();
+    pool.ParallelFor(total, chunk, [&](std::size_t begin, std::size_t end, int worker)
+    {
+        game_tally& a = acc[worker];
+        for(std::size_t k = begin; k < end; ++k)
+        {
+            std::size_t   g = k % games;
+            std::size_t   i = pairings[k / games].first;
+            std::size_t   j = pairings[k / games].second;
+            std::uint64_t game_seed = rng::Stream(seed, g / 2).Next();
+            int res = play_game(entrants[i], entrants[j], game_seed, (g & 1) != 0);
+            a.games++;
+            a.played[i * n + j]++;
+            if(res > 0)       a.score[i * n + j] += 1.;
+            else if(res == 0)
+            {
+                a.score[i * n + j] += 0.5;
+                a.aborted++;
+            }
+        }
+    });
+    auto t1 = std::chrono::steady_clock::now();
+
+    // merge the results, both sides of each pairing
+    game_tally tot(0, n);
+    for(const game_tally& a : acc) tot.Merge(a);
+    for(const auto& p : pairings)
+    {
+        std::size_t ij = p.first * n + p.second, ji = p.second * n + p.first;
+        tot.played[ji] = tot.played[ij];
+        tot.score[ji] = tot.played[ij] - tot.score[ij];
+    }
+    std::vector<rating> ratings = fit_ratings(tot.score, tot.played, n);
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+
+    // print the report
+    std::size_t width = 8;
+    for(const strategy_variant& e : entrants) width = std::max(width, e.label.size() + 2);
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "    seed       : " << seed << '\n';
+    std::cout << "    entrants   : " << n << " (" << pairings.size() << " pairings)\n";
+    std::cout << "    threads    : " << pool.Size() << '\n';
+    std::cout << "    games      : " << total << " (" << tot.aborted << " aborted, scored as draws)\n";
+    std::cout << "    elapsed    : " << std::setprecision(2) << seconds << " s\n";
+    std::cout << "    throughput : " << total / seconds << " games/s\n";
+    std::cout << std::setprecision(1) << '\n';
+    // results matrix: score % of the row entrant against the column entrant
+    std::cout << "    " << std::setw(width) << std::left << "score %" << std::right;
+    for(const strategy_variant& e : entrants) std::cout << std::setw(width) << e.label;
+    std::cout << '\n';
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        std::cout << "    " << std::setw(width) << std::left << entrants[i].label << std::right;
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            if(i == j) std::cout << std::setw(width) << "-";
+            else       std::cout << std::setw(width) << 100. * tot.score[i * n + j] / tot.played[i * n + j];
+        }
+        std::cout << '\n';
+    }
+    std::cout << '\n';
+    // ratings, best first
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&ratings](std::size_t a, std::size_t b) { return ratings[a].elo > ratings[b].elo; });
+    std::cout << "    rank " << std::setw(width) << std::left << "entrant" << std::right
+              << std::setw(10) << "games" << std::setw(10) << "score %" << std::setw(10) << "elo" << std::setw(10) << "95 %" << '\n';
+    for(std::size_t r = 0; r < n; ++r)
+    {
+        std::size_t i = order[r];
+        double score = 0.;
+        long   played = 0;
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            if(i == j) continue;
+            score  += tot.score[i * n + j];
+            played += tot.played[i * n + j];
+        }
+        std::cout << "    " << std::setw(4) << r + 1 << ' ' << std::setw(width) << std::left << entrants[i].label << std::right
+                  << std::setw(10) << played << std::setw(10) << 100. * score / played
+                  << std::setw(10) << ratings[i].elo << std::setw(6) << "+/- " << std::setw(4) << ratings[i].ci95 << '\n';
+    }
+    std::cout << std::endl;
+    // program end
+    return 0;
+}
\ No newline at end of file
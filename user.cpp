@@ -48,34 +48,41 @@
 //******************************************************************************
 // initialization
 //------------------------------------------------------------------------------
-user::user() : player("User")
+user::user(std::istream& in, std::ostream& out) : player("User"), _in(in), _out(out)
 {}
 
 // game play
 //------------------------------------------------------------------------------
 std::string user::Fire() noexcept
-{
-    std::cout << "\n\n\n";
-    return _Input();
-}
-
-// input methods
-//------------------------------------------------------------------------------
-std::string user::_Input() noexcept
 {
     std::string ans;
-    // start an infinite loop
+    AskFire();
     do
     {
-        // ask for input
-        ans = ask("Insert coordinates");
-        // if the user ask for a menu
-        if(ans == "menu") break;
-    } while(!_IsValidInput(ans));
-    // return the input
+        ans.clear();
+        _in >> ans;
+    } while(!TakeFire(ans) && _in);
     return ans;
 }
 
+//------------------------------------------------------------------------------
+void user::AskFire() noexcept
+{
+    _out << "\n\n\n";
+    prompt("Insert coordinates", _out);
+}
+
+//------------------------------------------------------------------------------
+bool user::TakeFire(std::string& ans) noexcept
+{
+    // a shot or the menu
+    if(ans == "menu" || _IsValidInput(ans)) return true;
+    // ask for input again
+    prompt("Insert coordinates", _out);
+    return false;
+}
+
+// input methods
 //------------------------------------------------------------------------------
 bool user::_IsValidInput(std::string& str) noexcept
 {
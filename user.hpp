@@ -42,6 +42,7 @@
 #ifndef __USER_HPP__
 #define __USER_HPP__
 
+#include <iostream>
 #include "player.hpp"
 
 // user class
@@ -50,16 +51,24 @@ class user: public player
 {
     public:
         // initialization
-        user();
+        user(std::istream& in = std::cin, std::ostream& out = std::cout);
 
         // game play
-        std::string Fire() noexcept;
+        std::string Fire() noexcept;                 // blocking: waits for a shot or "menu"
+
+        // game play (input driven): AskFire() prints the prompt, TakeFire() takes
+        // one answer and asks again if it is neither a shot nor "menu"
+        void        AskFire() noexcept;
+        bool        TakeFire(std::string& ans) noexcept;
 
     protected:
         // input methods
-        std::string _Input()                        noexcept;
         bool        _IsValidInput(std::string& str) noexcept;
         void        _RunMenu()                      noexcept;
+
+        // instance variables
+        std::istream& _in;
+        std::ostream& _out;
 };
 
 #endif /* __USER_HPP__ */
\ No newline at end of file